@@ -19,7 +19,26 @@ public class RMC : ModuleRules
     "GeometryCollectionEngine",
     "FieldSystemEngine",
     "ChaosSolverEngine",
-    "Niagara" });
+    "NetCore",
+    "ReplicationGraph",
+    "Mover",
+    "NetworkPrediction",
+    "SignificanceManager",
+    "MassEntity",
+    "MassCommon",
+    "MassSpawner" });
+
+		// Effects only; a dedicated server never renders them
+		if (Target.Type != TargetType.Server)
+		{
+			PublicDependencyModuleNames.Add("Niagara");
+		}
+
+		// Editor only, so the net correction test can start its own PIE session
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("UnrealEd");
+		}
 		
 		// Include directories
 		PrivateIncludePaths.AddRange(new string[] {
@@ -11,5 +11,8 @@ public class RMCTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_4;
 		ExtraModuleNames.Add("RMC");
+
+		// Compile Iris in; net.Iris.UseIrisReplication selects it at runtime
+		bUseIris = true;
 	}
 }
@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCCorrectionStats.h"
+
+void FRMCCorrectionStats::Record(ERMCPredictedMovementMode Mode, bool bCorrected, float Error)
+{
+    const int32 Index = static_cast<int32>(Mode);
+    ++MovesChecked[Index];
+    if (bCorrected)
+    {
+        ++Corrections[Index];
+    }
+    TotalError[Index] += Error;
+    MaxError[Index] = FMath::Max(MaxError[Index], Error);
+}
+
+void FRMCCorrectionStats::Append(const FRMCCorrectionStats& Other)
+{
+    for (int32 Index = 0; Index < NumModes; ++Index)
+    {
+        MovesChecked[Index] += Other.MovesChecked[Index];
+        Corrections[Index] += Other.Corrections[Index];
+        TotalError[Index] += Other.TotalError[Index];
+        MaxError[Index] = FMath::Max(MaxError[Index], Other.MaxError[Index]);
+    }
+}
+
+int32 FRMCCorrectionStats::GetTotalMovesChecked() const
+{
+    int32 Total = 0;
+    for (int32 Index = 0; Index < NumModes; ++Index)
+    {
+        Total += MovesChecked[Index];
+    }
+    return Total;
+}
+
+int32 FRMCCorrectionStats::GetTotalCorrections() const
+{
+    int32 Total = 0;
+    for (int32 Index = 0; Index < NumModes; ++Index)
+    {
+        Total += Corrections[Index];
+    }
+    return Total;
+}
+
+float FRMCCorrectionStats::GetCorrectionRate() const
+{
+    const int32 Moves = GetTotalMovesChecked();
+    return Moves > 0 ? static_cast<float>(GetTotalCorrections()) / Moves : 0.0f;
+}
+
+float FRMCCorrectionStats::GetMeanError(ERMCPredictedMovementMode Mode) const
+{
+    const int32 Index = static_cast<int32>(Mode);
+    return MovesChecked[Index] > 0 ? TotalError[Index] / MovesChecked[Index] : 0.0f;
+}
@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RMCTrajectoryPrediction.h"
+
+/**
+ * Server-side record of how far client moves landed from where the server put them, split by
+ * movement mode. Every checked move counts; a correction is a move the server sent back.
+ */
+struct RMC_API FRMCCorrectionStats
+{
+    static constexpr int32 NumModes = static_cast<int32>(ERMCPredictedMovementMode::Dashing) + 1;
+
+    int32 MovesChecked[NumModes] = {};
+    int32 Corrections[NumModes] = {};
+    float TotalError[NumModes] = {};
+    float MaxError[NumModes] = {};
+
+    /** Adds one checked move. Error is the distance between the client's and the server's positions. */
+    void Record(ERMCPredictedMovementMode Mode, bool bCorrected, float Error);
+
+    void Append(const FRMCCorrectionStats& Other);
+
+    void Reset() { *this = FRMCCorrectionStats(); }
+
+    int32 GetTotalMovesChecked() const;
+
+    int32 GetTotalCorrections() const;
+
+    /** Fraction of checked moves that were corrected, or zero if none were checked */
+    float GetCorrectionRate() const;
+
+    /** Mean error over the mode's checked moves, or zero if none were checked */
+    float GetMeanError(ERMCPredictedMovementMode Mode) const;
+};
@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMoveBandwidthStats.h"
+#include "Misc/FileHelper.h"
+
+void FRMCMoveBandwidthStats::Record(ERMCMoveTraffic Traffic, ERMCPredictedMovementMode Mode, int64 NumBits, double Time)
+{
+    const int32 TrafficIndex = static_cast<int32>(Traffic);
+    const int32 ModeIndex = static_cast<int32>(Mode);
+
+    if (StartTime < 0.0)
+    {
+        StartTime = Time;
+    }
+
+    ++Messages[TrafficIndex][ModeIndex];
+    Bits[TrafficIndex][ModeIndex] += NumBits;
+
+    const int32 Bucket = FMath::Min(static_cast<int32>(NumBits / BucketBits), NumBuckets - 1);
+    ++Histogram[TrafficIndex][ModeIndex][Bucket];
+}
+
+bool FRMCMoveBandwidthStats::WriteCsv(const FString& Path, double Time) const
+{
+    const double Seconds = StartTime >= 0.0 ? FMath::Max(Time - StartTime, 1.0) : 1.0;
+    const UEnum* ModeEnum = StaticEnum<ERMCPredictedMovementMode>();
+
+    FString Csv = TEXT("Traffic,Mode,Messages,TotalBits,AverageBits,BitsPerSecond");
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Csv += FString::Printf(TEXT(",%d-%d"), Bucket * BucketBits, (Bucket + 1) * BucketBits - 1);
+    }
+    Csv += TEXT("\n");
+
+    for (int32 TrafficIndex = 0; TrafficIndex < NumTraffic; ++TrafficIndex)
+    {
+        for (int32 ModeIndex = 0; ModeIndex < NumModes; ++ModeIndex)
+        {
+            const int32 Count = Messages[TrafficIndex][ModeIndex];
+            if (Count == 0)
+            {
+                continue;
+            }
+
+            Csv += FString::Printf(TEXT("%s,%s,%d,%lld,%.1f,%.0f"), GetTrafficName(static_cast<ERMCMoveTraffic>(TrafficIndex)),
+                *ModeEnum->GetNameStringByIndex(ModeIndex), Count, Bits[TrafficIndex][ModeIndex],
+                static_cast<double>(Bits[TrafficIndex][ModeIndex]) / Count, Bits[TrafficIndex][ModeIndex] / Seconds);
+
+            for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+            {
+                Csv += FString::Printf(TEXT(",%d"), Histogram[TrafficIndex][ModeIndex][Bucket]);
+            }
+            Csv += TEXT("\n");
+        }
+    }
+
+    return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+const TCHAR* FRMCMoveBandwidthStats::GetTrafficName(ERMCMoveTraffic Traffic)
+{
+    switch (Traffic)
+    {
+    case ERMCMoveTraffic::ServerMoveSent:
+        return TEXT("ServerMoveSent");
+    case ERMCMoveTraffic::ServerMoveReceived:
+        return TEXT("ServerMoveReceived");
+    case ERMCMoveTraffic::MoveResponseSent:
+        return TEXT("MoveResponseSent");
+    default:
+        return TEXT("MoveResponseReceived");
+    }
+}
+
+FRMCMoveBandwidthStats& FRMCMoveBandwidthStats::Get()
+{
+    static FRMCMoveBandwidthStats Stats;
+    return Stats;
+}
@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RMCTrajectoryPrediction.h"
+
+/**
+ * Which movement message a sample belongs to and which way it went
+ */
+enum class ERMCMoveTraffic : uint8
+{
+    ServerMoveSent,
+    ServerMoveReceived,
+    MoveResponseSent,
+    MoveResponseReceived
+};
+
+/**
+ * Process-wide count of the bits character movement messages take, by message, direction and the
+ * movement mode the sender was in. Filled in as the RMC move containers serialize, so RPC headers and
+ * packet overhead are not included.
+ */
+struct RMC_API FRMCMoveBandwidthStats
+{
+    static constexpr int32 NumTraffic = static_cast<int32>(ERMCMoveTraffic::MoveResponseReceived) + 1;
+    static constexpr int32 NumModes = static_cast<int32>(ERMCPredictedMovementMode::Dashing) + 1;
+
+    // Histogram buckets are this many bits wide; the last bucket takes everything larger
+    static constexpr int32 BucketBits = 16;
+    static constexpr int32 NumBuckets = 64;
+
+    int32 Messages[NumTraffic][NumModes] = {};
+    int64 Bits[NumTraffic][NumModes] = {};
+    int32 Histogram[NumTraffic][NumModes][NumBuckets] = {};
+
+    // World time of the first sample since the last reset
+    double StartTime = -1.0;
+
+    void Record(ERMCMoveTraffic Traffic, ERMCPredictedMovementMode Mode, int64 NumBits, double Time);
+
+    void Reset() { *this = FRMCMoveBandwidthStats(); }
+
+    /** Writes one row per message, direction and mode with totals and the size histogram. Returns false if the file couldn't be written. */
+    bool WriteCsv(const FString& Path, double Time) const;
+
+    static const TCHAR* GetTrafficName(ERMCMoveTraffic Traffic);
+
+    static FRMCMoveBandwidthStats& Get();
+};
@@ -0,0 +1,208 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMovementBatch.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#if INTEL_ISPC
+#include "RMCMovementKernels.ispc.generated.h"
+#endif
+
+#if !defined(RMC_MOVEMENT_ISPC_ENABLED_DEFAULT)
+#define RMC_MOVEMENT_ISPC_ENABLED_DEFAULT 1
+#endif
+
+// Support run-time toggling on supported platforms in non-shipping configurations
+#if !INTEL_ISPC || UE_BUILD_SHIPPING
+static constexpr bool bRMCMovement_ISPC_Enabled = INTEL_ISPC && RMC_MOVEMENT_ISPC_ENABLED_DEFAULT;
+#else
+static bool bRMCMovement_ISPC_Enabled = RMC_MOVEMENT_ISPC_ENABLED_DEFAULT;
+static FAutoConsoleVariableRef CVarRMCMovementISPCEnabled(
+    TEXT("rmc.Movement.ISPC"),
+    bRMCMovement_ISPC_Enabled,
+    TEXT("Whether to use ISPC kernels for batched RMC movement bookkeeping"));
+#endif
+
+void FRMCMovementBookkeepingBatch::SetNum(int32 NumAgents)
+{
+    VelocityX.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+    VelocityY.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+    VelocityZ.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+
+    Momentum.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+    MaxMomentum.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+    MomentumBuildRate.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+    MomentumDecayRate.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+    MaxWalkSpeed.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+
+    SpeedCap.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+    SpeedCapDamping.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+
+    Flags.SetNumUninitialized(NumAgents, EAllowShrinking::No);
+}
+
+void FRMCMovementBookkeepingBatch::Update(float DeltaTime)
+{
+    if (bRMCMovement_ISPC_Enabled)
+    {
+        UpdateISPC(DeltaTime);
+    }
+    else
+    {
+        UpdateScalar(DeltaTime);
+    }
+}
+
+void FRMCMovementBookkeepingBatch::UpdateScalar(float DeltaTime)
+{
+    const int32 NumAgents = Num();
+    for (int32 Index = 0; Index < NumAgents; ++Index)
+    {
+        const float VX = VelocityX[Index];
+        const float VY = VelocityY[Index];
+        const float VZ = VelocityZ[Index];
+        uint8 AgentFlags = Flags[Index] & ~ERMCBookkeepingFlags::OutputMask;
+
+        const float SpeedSquared2D = VX * VX + VY * VY;
+        const float SpeedSquared = SpeedSquared2D + VZ * VZ;
+
+        // Momentum builds at high speed and decays at low speed
+        const float WalkSpeed = MaxWalkSpeed[Index];
+        float MomentumDelta = 0.0f;
+        if (SpeedSquared > FMath::Square(WalkSpeed * 1.2f))
+        {
+            MomentumDelta = MomentumBuildRate[Index] * DeltaTime;
+        }
+        else if (SpeedSquared < FMath::Square(WalkSpeed * 0.5f))
+        {
+            MomentumDelta = -MomentumDecayRate[Index] * DeltaTime;
+        }
+
+        if (MomentumDelta != 0.0f)
+        {
+            Momentum[Index] = FMath::Clamp(Momentum[Index] + MomentumDelta, 0.0f, MaxMomentum[Index]);
+        }
+
+        // Speed cap, applied last so it takes effect before the next physics step
+        const float Cap = SpeedCap[Index];
+        const bool bCapZ = (AgentFlags & ERMCBookkeepingFlags::SpeedCapZ) != 0;
+        const float Speed = FMath::Sqrt(bCapZ ? SpeedSquared : SpeedSquared2D);
+        if (Cap > 0.0f && Speed > Cap)
+        {
+            const float NewSpeed = FMath::Lerp(Speed, Cap, 1.0f - SpeedCapDamping[Index]);
+            const float Scale = NewSpeed / Speed;
+            VelocityX[Index] = VX * Scale;
+            VelocityY[Index] = VY * Scale;
+            if (bCapZ)
+            {
+                VelocityZ[Index] = VZ * Scale;
+            }
+            AgentFlags |= ERMCBookkeepingFlags::SpeedCapped;
+        }
+
+        Flags[Index] = AgentFlags;
+    }
+}
+
+void FRMCMovementBookkeepingBatch::UpdateISPC(float DeltaTime)
+{
+#if INTEL_ISPC
+    ispc::UpdateMovementBookkeeping(
+        VelocityX.GetData(),
+        VelocityY.GetData(),
+        VelocityZ.GetData(),
+        Momentum.GetData(),
+        MaxMomentum.GetData(),
+        MomentumBuildRate.GetData(),
+        MomentumDecayRate.GetData(),
+        MaxWalkSpeed.GetData(),
+        SpeedCap.GetData(),
+        SpeedCapDamping.GetData(),
+        Flags.GetData(),
+        DeltaTime,
+        Num());
+#else
+    UpdateScalar(DeltaTime);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Benchmark
+
+namespace RMCMovementBatchBenchmark
+{
+    static void FillRandom(FRMCMovementBookkeepingBatch& Batch, int32 NumAgents, int32 Seed)
+    {
+        FRandomStream Random(Seed);
+        Batch.SetNum(NumAgents);
+
+        for (int32 Index = 0; Index < NumAgents; ++Index)
+        {
+            Batch.VelocityX[Index] = Random.FRandRange(-3500.0f, 3500.0f);
+            Batch.VelocityY[Index] = Random.FRandRange(-3500.0f, 3500.0f);
+            Batch.VelocityZ[Index] = Random.FRandRange(-1000.0f, 1000.0f);
+
+            Batch.Momentum[Index] = Random.FRandRange(0.0f, 100.0f);
+            Batch.MaxMomentum[Index] = 100.0f;
+            Batch.MomentumBuildRate[Index] = 10.0f;
+            Batch.MomentumDecayRate[Index] = 5.0f;
+            Batch.MaxWalkSpeed[Index] = 600.0f;
+
+            Batch.SpeedCap[Index] = 3000.0f;
+            Batch.SpeedCapDamping[Index] = 0.8f;
+
+            Batch.Flags[Index] = Random.RandHelper(2) ? ERMCBookkeepingFlags::SpeedCapZ : 0;
+        }
+    }
+
+    static void Run(const TArray<FString>& Args)
+    {
+        const int32 NumAgents = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 200;
+        const int32 NumIterations = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 10000;
+        const float DeltaTime = 1.0f / 60.0f;
+
+        FRMCMovementBookkeepingBatch ScalarBatch;
+        FRMCMovementBookkeepingBatch KernelBatch;
+        FillRandom(ScalarBatch, NumAgents, 1337);
+        FillRandom(KernelBatch, NumAgents, 1337);
+
+        double StartTime = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            ScalarBatch.UpdateScalar(DeltaTime);
+        }
+        const double ScalarSeconds = FPlatformTime::Seconds() - StartTime;
+
+        StartTime = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            KernelBatch.UpdateISPC(DeltaTime);
+        }
+        const double KernelSeconds = FPlatformTime::Seconds() - StartTime;
+
+        // Both paths must agree before the timings mean anything
+        float MaxError = 0.0f;
+        for (int32 Index = 0; Index < NumAgents; ++Index)
+        {
+            MaxError = FMath::Max(MaxError, FMath::Abs(ScalarBatch.Momentum[Index] - KernelBatch.Momentum[Index]));
+            MaxError = FMath::Max(MaxError, FMath::Abs(ScalarBatch.VelocityX[Index] - KernelBatch.VelocityX[Index]));
+            MaxError = FMath::Max(MaxError, FMath::Abs(ScalarBatch.VelocityZ[Index] - KernelBatch.VelocityZ[Index]));
+        }
+
+        const double ScalarNsPerAgent = ScalarSeconds * 1e9 / (double(NumAgents) * NumIterations);
+        const double KernelNsPerAgent = KernelSeconds * 1e9 / (double(NumAgents) * NumIterations);
+
+        UE_LOG(LogTemp, Display, TEXT("RMC bookkeeping benchmark: %d agents x %d iterations (ISPC %s)"),
+            NumAgents, NumIterations, INTEL_ISPC ? TEXT("compiled") : TEXT("not compiled, kernel path is scalar"));
+        UE_LOG(LogTemp, Display, TEXT("  Scalar: %.3f ms total, %.2f ns/agent"), ScalarSeconds * 1000.0, ScalarNsPerAgent);
+        UE_LOG(LogTemp, Display, TEXT("  Kernel: %.3f ms total, %.2f ns/agent (%.2fx)"), KernelSeconds * 1000.0, KernelNsPerAgent,
+            KernelSeconds > 0.0 ? ScalarSeconds / KernelSeconds : 0.0);
+        UE_LOG(LogTemp, Display, TEXT("  Max difference between paths: %f"), MaxError);
+    }
+
+    static FAutoConsoleCommand BenchmarkCommand(
+        TEXT("rmc.Movement.BenchKernels"),
+        TEXT("Times the scalar and ISPC movement bookkeeping paths. Usage: rmc.Movement.BenchKernels [NumAgents=200] [Iterations=10000]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-agent flag bits shared with RMCMovementKernels.ispc
+ */
+namespace ERMCBookkeepingFlags
+{
+    enum Type : uint8
+    {
+        // Inputs
+        SpeedCapZ       = 1 << 0,
+
+        // Outputs, cleared at the start of every update
+        SpeedCapped     = 1 << 1,
+
+        OutputMask      = SpeedCapped
+    };
+}
+
+/**
+ * Packed per-agent data for the per-frame movement bookkeeping: momentum and the global speed cap.
+ * Kept as structure-of-arrays so the whole set of characters is updated in one vectorized pass.
+ */
+struct RMC_API FRMCMovementBookkeepingBatch
+{
+    TArray<float> VelocityX;
+    TArray<float> VelocityY;
+    TArray<float> VelocityZ;
+
+    TArray<float> Momentum;
+    TArray<float> MaxMomentum;
+    TArray<float> MomentumBuildRate;
+    TArray<float> MomentumDecayRate;
+    TArray<float> MaxWalkSpeed;
+
+    TArray<float> SpeedCap;
+    TArray<float> SpeedCapDamping;
+
+    TArray<uint8> Flags;
+
+    /** Resizes every lane without initializing new entries */
+    void SetNum(int32 NumAgents);
+
+    int32 Num() const { return Flags.Num(); }
+
+    /** Runs the update with the ISPC kernel when available, otherwise the scalar path */
+    void Update(float DeltaTime);
+
+    /** Reference scalar implementation, also used when ISPC is disabled */
+    void UpdateScalar(float DeltaTime);
+
+    /** Vectorized implementation. Falls back to the scalar path in builds without ISPC. */
+    void UpdateISPC(float DeltaTime);
+};
@@ -1,11 +1,15 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "RMCMovementComponent.h"
+#include "RMCMovementBatch.h"
+#include "RMCMovementSubsystem.h"
 #include "GameFramework/Character.h"
 #include "Components/CapsuleComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "DrawDebugHelpers.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "../../RMCCharacter.h"
 
 // Custom movement mode enum values
@@ -13,6 +17,20 @@ static const uint8 CMOVE_WallRunning = 0;
 static const uint8 CMOVE_Sliding = 1;
 static const uint8 CMOVE_Dashing = 2;
 
+// Cycles spent in TickComponent and MoveAutonomous across all components, drained by ConsumeMovementSeconds
+static uint64 GRMCMovementCycles = 0;
+
+/** Adds the time until it goes out of scope to GRMCMovementCycles */
+struct FRMCMovementTimingScope
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    ~FRMCMovementTimingScope()
+    {
+        GRMCMovementCycles += FPlatformTime::Cycles64() - StartCycles;
+    }
+};
+
 URMCMovementComponent::URMCMovementComponent(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
@@ -68,6 +86,77 @@ URMCMovementComponent::URMCMovementComponent(const FObjectInitializer& ObjectIni
     SlideTimeRemaining = 0.0f;
     CurrentWallNormal = FVector::ZeroVector;
     DashDirection = FVector::ZeroVector;
+    bUseBatchedBookkeeping = false;
+
+    // Initialize event throttling
+    MomentumBroadcastQuantum = 1.0f;
+    MomentumBroadcastMinInterval = 0.1f;
+    LastBroadcastMomentum = -1.0f;
+    LastMomentumBroadcastTime = 0.0;
+
+    // Assume every Blueprint event is implemented until BeginPlay knows better
+    bScriptWallRunBegin = true;
+    bScriptWallRunEnd = true;
+    bScriptSlideBegin = true;
+    bScriptSlideEnd = true;
+    bScriptDashBegin = true;
+    bScriptDashEnd = true;
+    bScriptDoubleJump = true;
+    bScriptPhysicsProfileChanged = true;
+    bScriptAddMomentum = true;
+    bScriptReduceMomentum = true;
+    bSuppressMovementEvents = false;
+    bRegisteredForBatchedBookkeeping = false;
+
+    // Replicated state
+    ReplicatedMomentum = 0;
+    ReplicatedWallNormalYaw = 0;
+    ReplicatedDashYaw = 0;
+    PhysicsProfileIndex = 0;
+
+    // Initialize movement LOD
+    ReducedLODTickInterval = 1.0f / 30.0f;
+    MinimalLODTickInterval = 0.1f;
+    ReducedLODWallProbeDirections = 3;
+    ReducedLODWallProbeCacheSeconds = 0.1f;
+    MovementLOD = ERMCMovementLOD::Full;
+    LastWallProbeTime = -1.0;
+    LastWallProbeNormal = FVector::ZeroVector;
+    bLastWallProbeHit = false;
+    bAwaitingClientPhysicsProfile = false;
+    bLastReplicatedWallRunning = false;
+    bLastReplicatedSliding = false;
+    bLastReplicatedDashing = false;
+    SetIsReplicatedByDefault(true);
+
+    // Initialize adaptive update rate
+    bAdaptiveNetUpdateFrequency = true;
+    IdleNetUpdateFrequency = 10.0f;
+    MaxNetUpdateFrequency = 100.0f;
+    HighSpeedNetUpdateThreshold = 1500.0f;
+    NetUpdateBoostDuration = 0.5f;
+    NetUpdateBoostEndTime = 0.0;
+
+    // Initialize simulated proxy handling
+    bModeAwareProxySimulation = true;
+    WallRunProxySmoothLocationTime = 0.06f;
+    SlideProxySmoothLocationTime = 0.08f;
+    DashProxySmoothLocationTime = 0.03f;
+    ProxyModeElapsedTime = 0.0f;
+    DefaultProxySmoothLocationTime = NetworkSimulatedSmoothLocationTime;
+
+    // Initialize client-authoritative movement
+    bClientAuthoritativeMovement = false;
+    ClientAuthEnvelopeTolerance = 1.15f;
+    ClientAuthDashBudget = 0.0f;
+    ClientAuthWallRunTime = 0.0f;
+    ClientAuthMovesAccepted = 0;
+    ClientAuthMovesRejected = 0;
+    bLastMoveClientAuthoritative = false;
+
+    // Measured move messages
+    SetNetworkMoveDataContainer(RMCNetworkMoveDataContainer);
+    SetMoveResponseDataContainer(RMCMoveResponseDataContainer);
     
     // Initialize speed cap properties
     GlobalSpeedCap = 3000.0f;
@@ -131,81 +220,145 @@ void URMCMovementComponent::BeginPlay()
 {
     Super::BeginPlay();
 
+    CacheScriptEventImplementations();
+
+    DefaultProxySmoothLocationTime = NetworkSimulatedSmoothLocationTime;
+
     // Initialize momentum
     CurrentMomentum = MaxMomentum * 0.5f;
-    OnMomentumChanged.Broadcast(CurrentMomentum);
+    BroadcastMomentumChanged(true);
     
     // Apply the current profile (in case it was changed in editor)
     if (CurrentProfileName != NAME_None)
     {
         SetMovementPhysicsProfile(CurrentProfileName);
     }
+
+    if (URMCMovementSubsystem* Subsystem = GetWorld()->GetSubsystem<URMCMovementSubsystem>())
+    {
+        Subsystem->RegisterComponent(this);
+        bRegisteredForBatchedBookkeeping = true;
+    }
 }
 
-// Physics Profile Management
-bool URMCMovementComponent::SetMovementPhysicsProfile(FName ProfileName)
+void URMCMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    // Find the profile with the given name
-    for (const FMovementPhysicsProfile& Profile : PhysicsProfiles)
+    if (UWorld* World = GetWorld())
     {
-        if (Profile.ProfileName == ProfileName)
+        if (URMCMovementSubsystem* Subsystem = World->GetSubsystem<URMCMovementSubsystem>())
         {
-            // Apply the profile settings
-            // Wall Running
-            WallRunSpeed = Profile.WallRunSpeed;
-            WallRunGravityScale = Profile.WallRunGravityScale;
-            WallRunJumpOffForce = Profile.WallRunJumpOffForce;
-            MinWallRunHeight = Profile.MinWallRunHeight;
-            MaxWallRunTime = Profile.MaxWallRunTime;
-            WallRunControlMultiplier = Profile.WallRunControlMultiplier;
-            WallAttractionForce = Profile.WallAttractionForce;
-            MaxWallRunSurfaceAngle = Profile.MaxWallRunSurfaceAngle;
-            
-            // Sliding
-            SlideSpeed = Profile.SlideSpeed;
-            SlideFriction = Profile.SlideFriction;
-            SlideMinDuration = Profile.SlideMinDuration;
-            SlideMaxDuration = Profile.SlideMaxDuration;
-            SlideMinSpeed = Profile.SlideMinSpeed;
-            SlideDownhillAccelerationMultiplier = Profile.SlideDownhillAccelerationMultiplier;
-            SlideCapsuleHeightScale = Profile.SlideCapsuleHeightScale;
-            
-            // Dashing
-            DashDistance = Profile.DashDistance;
-            DashDuration = Profile.DashDuration;
-            DashCooldown = Profile.DashCooldown;
-            DashGroundSpeedBoost = Profile.DashGroundSpeedBoost;
-            DashAirSpeedBoost = Profile.DashAirSpeedBoost;
-            
-            // Double Jump
-            DoubleJumpZVelocity = Profile.DoubleJumpZVelocity;
-            
-            // Momentum
-            MomentumRetentionRate = Profile.MomentumRetentionRate;
-            MaxMomentum = Profile.MaxMomentum;
-            MomentumDecayRate = Profile.MomentumDecayRate;
-            MomentumBuildRate = Profile.MomentumBuildRate;
-            MomentumSpeedMultiplier = Profile.MomentumSpeedMultiplier;
-            MomentumAccelerationMultiplier = Profile.MomentumAccelerationMultiplier;
-            
-            // Speed Cap
-            GlobalSpeedCap = Profile.GlobalSpeedCap;
-            SpeedCapDamping = Profile.SpeedCapDamping;
-            bApplySpeedCapToZVelocity = Profile.bApplySpeedCapToZVelocity;
-            
-            // Update current profile name
-            CurrentProfileName = ProfileName;
-            
-            // Broadcast event
-            OnPhysicsProfileChanged.Broadcast(ProfileName);
-            OnPhysicsProfileChanged_BP(ProfileName);
-            
-            return true;
+            Subsystem->UnregisterComponent(this);
         }
     }
+    bRegisteredForBatchedBookkeeping = false;
+
+    Super::EndPlay(EndPlayReason);
+}
+
+// Physics Profile Management
+void URMCMovementComponent::ApplyPhysicsValues(const FMovementPhysicsProfile& Profile)
+{
+    // Wall Running
+    WallRunSpeed = Profile.WallRunSpeed;
+    WallRunGravityScale = Profile.WallRunGravityScale;
+    WallRunJumpOffForce = Profile.WallRunJumpOffForce;
+    MinWallRunHeight = Profile.MinWallRunHeight;
+    MaxWallRunTime = Profile.MaxWallRunTime;
+    WallRunControlMultiplier = Profile.WallRunControlMultiplier;
+    WallAttractionForce = Profile.WallAttractionForce;
+    MaxWallRunSurfaceAngle = Profile.MaxWallRunSurfaceAngle;
     
-    // Profile not found
-    return false;
+    // Sliding
+    SlideSpeed = Profile.SlideSpeed;
+    SlideFriction = Profile.SlideFriction;
+    SlideMinDuration = Profile.SlideMinDuration;
+    SlideMaxDuration = Profile.SlideMaxDuration;
+    SlideMinSpeed = Profile.SlideMinSpeed;
+    SlideDownhillAccelerationMultiplier = Profile.SlideDownhillAccelerationMultiplier;
+    SlideCapsuleHeightScale = Profile.SlideCapsuleHeightScale;
+    
+    // Dashing
+    DashDistance = Profile.DashDistance;
+    DashDuration = Profile.DashDuration;
+    DashCooldown = Profile.DashCooldown;
+    DashGroundSpeedBoost = Profile.DashGroundSpeedBoost;
+    DashAirSpeedBoost = Profile.DashAirSpeedBoost;
+    
+    // Double Jump
+    DoubleJumpZVelocity = Profile.DoubleJumpZVelocity;
+    
+    // Momentum
+    MomentumRetentionRate = Profile.MomentumRetentionRate;
+    MaxMomentum = Profile.MaxMomentum;
+    MomentumDecayRate = Profile.MomentumDecayRate;
+    MomentumBuildRate = Profile.MomentumBuildRate;
+    MomentumSpeedMultiplier = Profile.MomentumSpeedMultiplier;
+    MomentumAccelerationMultiplier = Profile.MomentumAccelerationMultiplier;
+    
+    // Speed Cap
+    GlobalSpeedCap = Profile.GlobalSpeedCap;
+    SpeedCapDamping = Profile.SpeedCapDamping;
+    bApplySpeedCapToZVelocity = Profile.bApplySpeedCapToZVelocity;
+}
+
+bool URMCMovementComponent::SetMovementPhysicsProfile(FName ProfileName)
+{
+    const int32 ProfileIndex = PhysicsProfiles.IndexOfByPredicate([ProfileName](const FMovementPhysicsProfile& Profile)
+    {
+        return Profile.ProfileName == ProfileName;
+    });
+
+    // Profile not found, or past what the network index can carry
+    if (ProfileIndex == INDEX_NONE || ProfileIndex >= MAX_uint8)
+    {
+        return false;
+    }
+
+    ApplyPhysicsProfileIndex(static_cast<uint8>(ProfileIndex + 1));
+
+    // The owning client predicts its own switches and sends them with its moves. A switch made only on the
+    // server has to reach the client first, and until it does the client's moves still carry the old one.
+    if (CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_Authority && CharacterOwner->GetRemoteRole() == ROLE_AutonomousProxy
+        && !CharacterOwner->IsLocallyControlled())
+    {
+        bAwaitingClientPhysicsProfile = true;
+        ClientSetPhysicsProfileIndex(PhysicsProfileIndex);
+    }
+
+    return true;
+}
+
+void URMCMovementComponent::ApplyPhysicsProfileIndex(uint8 Index)
+{
+    if (Index == 0 || Index > PhysicsProfiles.Num())
+    {
+        return;
+    }
+
+    const FMovementPhysicsProfile& Profile = PhysicsProfiles[Index - 1];
+    ApplyPhysicsValues(Profile);
+
+    // Update current profile name
+    CurrentProfileName = Profile.ProfileName;
+    PhysicsProfileIndex = Index;
+    MARK_PROPERTY_DIRTY_FROM_NAME(URMCMovementComponent, PhysicsProfileIndex, this);
+
+    // Not while replaying saved moves, which switch back and forth through profiles already announced
+    if (bSuppressMovementEvents || (CharacterOwner && CharacterOwner->bClientUpdating))
+    {
+        return;
+    }
+
+    // Broadcast event
+    OnPhysicsProfileChangedNative.Broadcast(Profile.ProfileName);
+    if (OnPhysicsProfileChanged.IsBound())
+    {
+        OnPhysicsProfileChanged.Broadcast(Profile.ProfileName);
+    }
+    if (bScriptPhysicsProfileChanged)
+    {
+        OnPhysicsProfileChanged_BP(Profile.ProfileName);
+    }
 }
 
 void URMCMovementComponent::ResetMovementPhysicsToDefaults()
@@ -220,111 +373,86 @@ void URMCMovementComponent::SaveCurrentPhysicsAsProfile(FName ProfileName)
     {
         return;
     }
-    
-    // Check if profile already exists
-    for (int32 i = 0; i < PhysicsProfiles.Num(); i++)
+
+    FMovementPhysicsProfile NewProfile = MakeCurrentPhysicsProfile();
+    NewProfile.ProfileName = ProfileName;
+
+    // Update the profile if it already exists, otherwise add it
+    int32 ProfileIndex = PhysicsProfiles.IndexOfByPredicate([ProfileName](const FMovementPhysicsProfile& Profile)
     {
-        if (PhysicsProfiles[i].ProfileName == ProfileName)
-        {
-            // Update existing profile
-            FMovementPhysicsProfile& Profile = PhysicsProfiles[i];
-            
-            // Wall Running
-            Profile.WallRunSpeed = WallRunSpeed;
-            Profile.WallRunGravityScale = WallRunGravityScale;
-            Profile.WallRunJumpOffForce = WallRunJumpOffForce;
-            Profile.MinWallRunHeight = MinWallRunHeight;
-            Profile.MaxWallRunTime = MaxWallRunTime;
-            Profile.WallRunControlMultiplier = WallRunControlMultiplier;
-            Profile.WallAttractionForce = WallAttractionForce;
-            Profile.MaxWallRunSurfaceAngle = MaxWallRunSurfaceAngle;
-            
-            // Sliding
-            Profile.SlideSpeed = SlideSpeed;
-            Profile.SlideFriction = SlideFriction;
-            Profile.SlideMinDuration = SlideMinDuration;
-            Profile.SlideMaxDuration = SlideMaxDuration;
-            Profile.SlideMinSpeed = SlideMinSpeed;
-            Profile.SlideDownhillAccelerationMultiplier = SlideDownhillAccelerationMultiplier;
-            Profile.SlideCapsuleHeightScale = SlideCapsuleHeightScale;
-            
-            // Dashing
-            Profile.DashDistance = DashDistance;
-            Profile.DashDuration = DashDuration;
-            Profile.DashCooldown = DashCooldown;
-            Profile.DashGroundSpeedBoost = DashGroundSpeedBoost;
-            Profile.DashAirSpeedBoost = DashAirSpeedBoost;
-            
-            // Double Jump
-            Profile.DoubleJumpZVelocity = DoubleJumpZVelocity;
-            
-            // Momentum
-            Profile.MomentumRetentionRate = MomentumRetentionRate;
-            Profile.MaxMomentum = MaxMomentum;
-            Profile.MomentumDecayRate = MomentumDecayRate;
-            Profile.MomentumBuildRate = MomentumBuildRate;
-            Profile.MomentumSpeedMultiplier = MomentumSpeedMultiplier;
-            Profile.MomentumAccelerationMultiplier = MomentumAccelerationMultiplier;
-            
-            // Speed Cap
-            Profile.GlobalSpeedCap = GlobalSpeedCap;
-            Profile.SpeedCapDamping = SpeedCapDamping;
-            Profile.bApplySpeedCapToZVelocity = bApplySpeedCapToZVelocity;
-            
-            CurrentProfileName = ProfileName;
-            return;
-        }
+        return Profile.ProfileName == ProfileName;
+    });
+    if (ProfileIndex != INDEX_NONE)
+    {
+        PhysicsProfiles[ProfileIndex] = NewProfile;
     }
-    
-    // Create new profile
-    FMovementPhysicsProfile NewProfile;
-    NewProfile.ProfileName = ProfileName;
-    
+    else
+    {
+        ProfileIndex = PhysicsProfiles.Add(NewProfile);
+    }
+
+    // The saved values are already in use, so this is now the active profile. Past what the index can carry it has none.
+    CurrentProfileName = ProfileName;
+    PhysicsProfileIndex = ProfileIndex < MAX_uint8 ? static_cast<uint8>(ProfileIndex + 1) : 0;
+    MARK_PROPERTY_DIRTY_FROM_NAME(URMCMovementComponent, PhysicsProfileIndex, this);
+}
+
+FMovementPhysicsProfile URMCMovementComponent::MakeCurrentPhysicsProfile() const
+{
+    FMovementPhysicsProfile Profile;
+    Profile.ProfileName = CurrentProfileName;
+
     // Wall Running
-    NewProfile.WallRunSpeed = WallRunSpeed;
-    NewProfile.WallRunGravityScale = WallRunGravityScale;
-    NewProfile.WallRunJumpOffForce = WallRunJumpOffForce;
-    NewProfile.MinWallRunHeight = MinWallRunHeight;
-    NewProfile.MaxWallRunTime = MaxWallRunTime;
-    NewProfile.WallRunControlMultiplier = WallRunControlMultiplier;
-    NewProfile.WallAttractionForce = WallAttractionForce;
-    NewProfile.MaxWallRunSurfaceAngle = MaxWallRunSurfaceAngle;
+    Profile.WallRunSpeed = WallRunSpeed;
+    Profile.WallRunGravityScale = WallRunGravityScale;
+    Profile.WallRunJumpOffForce = WallRunJumpOffForce;
+    Profile.MinWallRunHeight = MinWallRunHeight;
+    Profile.MaxWallRunTime = MaxWallRunTime;
+    Profile.WallRunControlMultiplier = WallRunControlMultiplier;
+    Profile.WallAttractionForce = WallAttractionForce;
+    Profile.MaxWallRunSurfaceAngle = MaxWallRunSurfaceAngle;
     
     // Sliding
-    NewProfile.SlideSpeed = SlideSpeed;
-    NewProfile.SlideFriction = SlideFriction;
-    NewProfile.SlideMinDuration = SlideMinDuration;
-    NewProfile.SlideMaxDuration = SlideMaxDuration;
-    NewProfile.SlideMinSpeed = SlideMinSpeed;
-    NewProfile.SlideDownhillAccelerationMultiplier = SlideDownhillAccelerationMultiplier;
-    NewProfile.SlideCapsuleHeightScale = SlideCapsuleHeightScale;
+    Profile.SlideSpeed = SlideSpeed;
+    Profile.SlideFriction = SlideFriction;
+    Profile.SlideMinDuration = SlideMinDuration;
+    Profile.SlideMaxDuration = SlideMaxDuration;
+    Profile.SlideMinSpeed = SlideMinSpeed;
+    Profile.SlideDownhillAccelerationMultiplier = SlideDownhillAccelerationMultiplier;
+    Profile.SlideCapsuleHeightScale = SlideCapsuleHeightScale;
     
     // Dashing
-    NewProfile.DashDistance = DashDistance;
-    NewProfile.DashDuration = DashDuration;
-    NewProfile.DashCooldown = DashCooldown;
-    NewProfile.DashGroundSpeedBoost = DashGroundSpeedBoost;
-    NewProfile.DashAirSpeedBoost = DashAirSpeedBoost;
+    Profile.DashDistance = DashDistance;
+    Profile.DashDuration = DashDuration;
+    Profile.DashCooldown = DashCooldown;
+    Profile.DashGroundSpeedBoost = DashGroundSpeedBoost;
+    Profile.DashAirSpeedBoost = DashAirSpeedBoost;
     
     // Double Jump
-    NewProfile.DoubleJumpZVelocity = DoubleJumpZVelocity;
+    Profile.DoubleJumpZVelocity = DoubleJumpZVelocity;
     
     // Momentum
-    NewProfile.MomentumRetentionRate = MomentumRetentionRate;
-    NewProfile.MaxMomentum = MaxMomentum;
-    NewProfile.MomentumDecayRate = MomentumDecayRate;
-    NewProfile.MomentumBuildRate = MomentumBuildRate;
-    NewProfile.MomentumSpeedMultiplier = MomentumSpeedMultiplier;
-    NewProfile.MomentumAccelerationMultiplier = MomentumAccelerationMultiplier;
+    Profile.MomentumRetentionRate = MomentumRetentionRate;
+    Profile.MaxMomentum = MaxMomentum;
+    Profile.MomentumDecayRate = MomentumDecayRate;
+    Profile.MomentumBuildRate = MomentumBuildRate;
+    Profile.MomentumSpeedMultiplier = MomentumSpeedMultiplier;
+    Profile.MomentumAccelerationMultiplier = MomentumAccelerationMultiplier;
     
     // Speed Cap
-    NewProfile.GlobalSpeedCap = GlobalSpeedCap;
-    NewProfile.SpeedCapDamping = SpeedCapDamping;
-    NewProfile.bApplySpeedCapToZVelocity = bApplySpeedCapToZVelocity;
+    Profile.GlobalSpeedCap = GlobalSpeedCap;
+    Profile.SpeedCapDamping = SpeedCapDamping;
+    Profile.bApplySpeedCapToZVelocity = bApplySpeedCapToZVelocity;
     
-    // Add to profiles array
-    PhysicsProfiles.Add(NewProfile);
-    CurrentProfileName = ProfileName;
+    return Profile;
+}
+
+const FMovementPhysicsProfile* URMCMovementComponent::FindPhysicsProfile(FName ProfileName) const
+{
+    return PhysicsProfiles.FindByPredicate([ProfileName](const FMovementPhysicsProfile& Profile)
+    {
+        return Profile.ProfileName == ProfileName;
+    });
 }
 
 TArray<FName> URMCMovementComponent::GetAvailablePhysicsProfileNames() const
@@ -372,70 +500,119 @@ void URMCMovementComponent::SetMomentumPhysics(float MaxValue, float BuildRate,
     MomentumAccelerationMultiplier = AccelMultiplier;
 }
 
+FRMCMovementParams URMCMovementComponent::MakeMovementParams() const
+{
+    FRMCMovementParams Params;
+
+    Params.WallRunSpeed = WallRunSpeed;
+    Params.WallRunGravityScale = WallRunGravityScale;
+    Params.WallRunControlMultiplier = WallRunControlMultiplier;
+    Params.WallAttractionForce = WallAttractionForce;
+
+    Params.SlideSpeed = SlideSpeed;
+    Params.SlideFriction = SlideFriction;
+    Params.SlideMinSpeed = SlideMinSpeed;
+    Params.SlideDownhillAccelerationMultiplier = SlideDownhillAccelerationMultiplier;
+
+    Params.DashDistance = DashDistance;
+    Params.DashDuration = DashDuration;
+
+    Params.MaxMomentum = MaxMomentum;
+    Params.MomentumBuildRate = MomentumBuildRate;
+    Params.MomentumDecayRate = MomentumDecayRate;
+
+    Params.GlobalSpeedCap = GlobalSpeedCap;
+    Params.SpeedCapDamping = SpeedCapDamping;
+    Params.bApplySpeedCapToZVelocity = bApplySpeedCapToZVelocity;
+
+    Params.MaxWalkSpeed = MaxWalkSpeed;
+    Params.GravityZ = GetGravityZ();
+
+    return Params;
+}
+
 void URMCMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
-    // Apply speed cap
-    if (GlobalSpeedCap > 0.0f)
+    FRMCMovementTimingScope TimingScope;
+
+    const FRMCMovementParams Params = MakeMovementParams();
+
+    ApplyPreMovementRules(DeltaTime, Params);
+
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    ApplyPostMovementRules(DeltaTime, Params);
+}
+
+double URMCMovementComponent::ConsumeMovementSeconds()
+{
+    const double Seconds = FPlatformTime::ToSeconds64(GRMCMovementCycles);
+    GRMCMovementCycles = 0;
+    return Seconds;
+}
+
+void URMCMovementComponent::ApplyPreMovementRules(float DeltaTime, const FRMCMovementParams& Params)
+{
+    // Apply speed cap (the batched pass applies it after movement instead)
+    float CurrentSpeed = 0.0f;
+    float NewSpeed = 0.0f;
+    if (!IsBookkeepingBatched() && FRMCMovementSimulation::ApplySpeedCap(Params, Velocity, CurrentSpeed, NewSpeed))
     {
-        // Check if we need to apply the cap
-        float CurrentSpeed;
-        if (bApplySpeedCapToZVelocity)
-        {
-            // Apply cap to full 3D velocity
-            CurrentSpeed = Velocity.Size();
-        }
-        else
+        // Debug output
+        ACharacter* Character = Cast<ACharacter>(GetOwner());
+        if (GEngine && Character && Character->IsA<ARMCCharacter>() && 
+            Cast<ARMCCharacter>(Character)->bDebugModeEnabled)
         {
-            // Apply cap only to horizontal velocity
-            CurrentSpeed = Velocity.Size2D();
+            GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, 
+                FString::Printf(TEXT("Speed Capped: %.1f → %.1f"), CurrentSpeed, NewSpeed));
         }
-        
-        if (CurrentSpeed > GlobalSpeedCap)
+    }
+}
+
+void URMCMovementComponent::ApplyPostMovementRules(float DeltaTime, const FRMCMovementParams& Params)
+{
+    // A proxy, in play or in a replay, takes its momentum, timers and mode flags from the server.
+    // It still delivers the momentum changes OnRep_ReplicatedMomentum left to the throttle.
+    if (IsReplicatedProxy())
+    {
+        BroadcastMomentumChanged();
+        return;
+    }
+
+    // Update momentum, cooldowns and timers (the batched pass does both after movement instead)
+    if (!IsBookkeepingBatched())
+    {
+        UpdateMomentum(DeltaTime);
+        AdvanceMovementTimers(DeltaTime);
+    }
+
+    // A client-authoritative owner decides its own mode exits
+    if (bClientAuthoritativeMovement && CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_Authority && !CharacterOwner->IsLocallyControlled())
+    {
+        BroadcastMomentumChanged();
+        MarkReplicatedStateDirty();
+        UpdateNetUpdateFrequency();
+        return;
+    }
+
+    // End slide if minimum duration has passed and player isn't providing input
+    if (bIsSliding && !MovementTimers.IsActive(ERMCMovementTimer::SlideMinDuration))
+    {
+        FVector InputVector = ConsumeInputVector();
+        if (InputVector.SizeSquared() < 0.1f)
         {
-            // Calculate new speed with damping
-            float NewSpeed = FMath::Lerp(CurrentSpeed, GlobalSpeedCap, 1.0f - SpeedCapDamping);
-            
-            if (bApplySpeedCapToZVelocity)
-            {
-                // Scale entire velocity
-                Velocity = Velocity.GetSafeNormal() * NewSpeed;
-            }
-            else
-            {
-                // Scale only horizontal velocity
-                FVector HorizontalVel = FVector(Velocity.X, Velocity.Y, 0.0f);
-                FVector NewHorizontalVel = HorizontalVel.GetSafeNormal() * NewSpeed;
-                Velocity.X = NewHorizontalVel.X;
-                Velocity.Y = NewHorizontalVel.Y;
-                // Z velocity is unchanged
-            }
-            
-            // Debug output
-            ACharacter* Character = Cast<ACharacter>(GetOwner());
-            if (GEngine && Character && Character->IsA<ARMCCharacter>() && 
-                Cast<ARMCCharacter>(Character)->bDebugModeEnabled)
-            {
-                GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, 
-                    FString::Printf(TEXT("Speed Capped: %.1f → %.1f"), CurrentSpeed, NewSpeed));
-            }
+            EndSlide();
         }
     }
-    
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    // Update momentum based on current movement
-    UpdateMomentum(DeltaTime);
-
-    // Update cooldowns and timers
-    UpdateDashCooldown(DeltaTime);
-    UpdateWallRunTime(DeltaTime);
-    UpdateSlideTime(DeltaTime);
+    // Deliver any momentum change the throttle held back
+    BroadcastMomentumChanged();
 
     // Check if we should end wall running due to conditions
     if (bIsWallRunning)
     {
         FVector WallNormal;
-        if (!FindWallRunSurface(WallNormal) || Velocity.SizeSquared() < 100.0f)
+        if (FRMCMovementSimulation::ShouldEndWallRun(Velocity, FindWallRunSurface(WallNormal)))
         {
             EndWallRun();
         }
@@ -444,23 +621,41 @@ void URMCMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickT
     // Check if we should end sliding due to conditions
     if (bIsSliding)
     {
-        if (Velocity.SizeSquared() < FMath::Square(SlideMinSpeed) || !IsMovingOnGround())
+        if (FRMCMovementSimulation::ShouldEndSlide(Params, Velocity, IsMovingOnGround()))
         {
             EndSlide();
         }
     }
+
+    MarkReplicatedStateDirty();
+    UpdateNetUpdateFrequency();
 }
 
 void URMCMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
 {
     Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
 
+    BoostNetUpdateFrequency();
+
+    if (CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_SimulatedProxy)
+    {
+        ProxyModeElapsedTime = 0.0f;
+        UpdateProxySmoothing();
+    }
+
     // Reset double jump when landing
     if (IsMovingOnGround() && PreviousMovementMode == MOVE_Falling)
     {
         bHasDoubleJumped = false;
     }
 
+    // A proxy gets its mode flags from the server. Ending an ability here would set the mode and move the
+    // actor again, and restore a slide capsule the proxy never lowered.
+    if (IsReplicatedProxy())
+    {
+        return;
+    }
+
     // End wall running if we change to a non-wall running mode
     if (bIsWallRunning && (MovementMode != MOVE_Custom || CustomMovementMode != CMOVE_WallRunning))
     {
@@ -477,8 +672,8 @@ void URMCMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovement
     if (bIsDashing && (MovementMode != MOVE_Custom || CustomMovementMode != CMOVE_Dashing))
     {
         bIsDashing = false;
-        OnDashEnd.Broadcast();
-        OnDashEnd_BP();
+        MovementTimers.Clear(ERMCMovementTimer::Dash);
+        BroadcastDashEnd();
     }
 }
 
@@ -603,6 +798,7 @@ void URMCMovementComponent::StartWallRun()
     // Set wall running state
     bIsWallRunning = true;
     CurrentWallNormal = WallNormal;
+    MovementTimers.Set(ERMCMovementTimer::WallRun, MaxWallRunTime);
     WallRunTimeRemaining = MaxWallRunTime;
 
     // Set custom movement mode
@@ -661,8 +857,7 @@ void URMCMovementComponent::StartWallRun()
     AddMomentum(10.0f);
 
     // Broadcast events
-    OnWallRunBegin.Broadcast(WallNormal);
-    OnWallRunBegin_BP(WallNormal);
+    BroadcastWallRunBegin(WallNormal);
     
     // Debug output
     if (GEngine && Character && Character->IsA<ARMCCharacter>() && 
@@ -683,14 +878,14 @@ void URMCMovementComponent::EndWallRun()
     // Reset wall running state
     bIsWallRunning = false;
     CurrentWallNormal = FVector::ZeroVector;
+    MovementTimers.Clear(ERMCMovementTimer::WallRun);
     WallRunTimeRemaining = 0.0f;
 
     // Return to falling movement mode
     SetMovementMode(MOVE_Falling);
 
     // Broadcast events
-    OnWallRunEnd.Broadcast();
-    OnWallRunEnd_BP();
+    BroadcastWallRunEnd();
 }
 
 bool URMCMovementComponent::CanWallRun() const
@@ -743,6 +938,25 @@ void URMCMovementComponent::WallRunJump()
 }
 
 bool URMCMovementComponent::FindWallRunSurface(FVector& OutWallNormal) const
+{
+    if (MovementLOD == ERMCMovementLOD::Full)
+    {
+        return ProbeWallRunSurface(OutWallNormal, MAX_int32);
+    }
+
+    // Lower tiers probe the likeliest directions and reuse the answer for a while
+    const double Now = GetWorld()->GetTimeSeconds();
+    if (LastWallProbeTime < 0.0 || Now - LastWallProbeTime >= ReducedLODWallProbeCacheSeconds)
+    {
+        bLastWallProbeHit = ProbeWallRunSurface(LastWallProbeNormal, ReducedLODWallProbeDirections);
+        LastWallProbeTime = Now;
+    }
+
+    OutWallNormal = LastWallProbeNormal;
+    return bLastWallProbeHit;
+}
+
+bool URMCMovementComponent::ProbeWallRunSurface(FVector& OutWallNormal, int32 MaxDirections) const
 {
     ACharacter* Character = Cast<ACharacter>(GetOwner());
     if (!Character)
@@ -796,6 +1010,11 @@ bool URMCMovementComponent::FindWallRunSurface(FVector& OutWallNormal) const
     DirectionsToCheck.Add(Character->GetActorForwardVector());
     DirectionsToCheck.Add(Character->GetActorRightVector());
     DirectionsToCheck.Add(-Character->GetActorRightVector());
+
+    if (DirectionsToCheck.Num() > MaxDirections)
+    {
+        DirectionsToCheck.SetNum(FMath::Max(MaxDirections, 1));
+    }
     
     // Calculate max Z component based on MaxWallRunSurfaceAngle
     // Convert degrees to radians and find the sine
@@ -874,22 +1093,6 @@ bool URMCMovementComponent::FindWallRunSurface(FVector& OutWallNormal) const
 
 void URMCMovementComponent::ApplyWallRunForces(float DeltaTime, const FVector& WallNormal)
 {
-    // Calculate wall run direction (along the wall)
-    FVector WallRunDirection = FVector::CrossProduct(WallNormal, FVector(0, 0, 1)).GetSafeNormal();
-    
-    // Make sure we're running in the correct direction along the wall
-    if (FVector::DotProduct(WallRunDirection, Velocity) < 0)
-    {
-        WallRunDirection = -WallRunDirection;
-    }
-    
-    // Apply reduced gravity using the configurable gravity scale
-    const float fGravityScale = WallRunGravityScale;
-    const FVector Gravity = FVector(0, 0, GetGravityZ() * fGravityScale * DeltaTime);
-    
-    // Apply wall attraction force to keep character on the wall using the configurable force
-    const FVector WallAttractionVector = -WallNormal * WallAttractionForce * DeltaTime;
-    
     // Get input vector for direction control
     FVector InputVector = FVector::ZeroVector;
     ACharacter* Character = Cast<ACharacter>(GetOwner());
@@ -898,42 +1101,7 @@ void URMCMovementComponent::ApplyWallRunForces(float DeltaTime, const FVector& W
         InputVector = ConsumeInputVector();
     }
     
-    // Calculate forward component of input (how much the player is pressing forward)
-    float ForwardInput = FVector::DotProduct(InputVector, WallRunDirection);
-    
-    // Calculate final velocity using the configurable wall run speed
-    // Use a higher base speed to ensure movement along the wall
-    float SpeedMultiplier = 1.0f;
-    
-    // If player is pressing forward, give a speed boost
-    if (ForwardInput > 0.1f)
-    {
-        SpeedMultiplier = 1.2f;
-    }
-    
-    // Set base velocity along the wall
-    Velocity = WallRunDirection * WallRunSpeed * SpeedMultiplier;
-    
-    // Apply gravity and wall attraction
-    Velocity += Gravity;
-    Velocity += WallAttractionVector;
-    
-    // Allow some control for the player using the configurable control multiplier
-    if (!InputVector.IsNearlyZero())
-    {
-        // Apply input to velocity (only along the wall)
-        FVector InputAlongWall = FVector::VectorPlaneProject(InputVector, WallNormal);
-        Velocity += InputAlongWall * WallRunControlMultiplier * 800.0f * DeltaTime;
-    }
-    
-    // Ensure minimum velocity along wall to prevent sticking
-    float CurrentSpeed = Velocity.Size2D();
-    if (CurrentSpeed < WallRunSpeed * 0.7f)
-    {
-        Velocity = WallRunDirection * WallRunSpeed * 0.7f;
-        Velocity += Gravity;
-        Velocity += WallAttractionVector;
-    }
+    Velocity = FRMCMovementSimulation::ApplyWallRunForces(MakeMovementParams(), Velocity, WallNormal, InputVector, DeltaTime);
     
     // Debug output
     if (GEngine && Character && Character->IsA<ARMCCharacter>() && 
@@ -944,20 +1112,6 @@ void URMCMovementComponent::ApplyWallRunForces(float DeltaTime, const FVector& W
     }
 }
 
-void URMCMovementComponent::UpdateWallRunTime(float DeltaTime)
-{
-    if (bIsWallRunning)
-    {
-        WallRunTimeRemaining -= DeltaTime;
-        
-        // End wall run if time expires
-        if (WallRunTimeRemaining <= 0)
-        {
-            EndWallRun();
-        }
-    }
-}
-
 //////////////////////////////////////////////////////////////////////////
 // Sliding Implementation
 
@@ -977,6 +1131,8 @@ void URMCMovementComponent::StartSlide()
     
     // Set sliding state
     bIsSliding = true;
+    MovementTimers.Set(ERMCMovementTimer::Slide, SlideMaxDuration);
+    MovementTimers.Set(ERMCMovementTimer::SlideMinDuration, SlideMinDuration);
     SlideTimeRemaining = SlideMaxDuration;
     
     // Set custom movement mode
@@ -998,8 +1154,7 @@ void URMCMovementComponent::StartSlide()
     AddMomentum(5.0f);
     
     // Broadcast events
-    OnSlideBegin.Broadcast();
-    OnSlideBegin_BP();
+    BroadcastSlideBegin();
 }
 
 void URMCMovementComponent::EndSlide()
@@ -1011,6 +1166,8 @@ void URMCMovementComponent::EndSlide()
     
     // Reset sliding state
     bIsSliding = false;
+    MovementTimers.Clear(ERMCMovementTimer::Slide);
+    MovementTimers.Clear(ERMCMovementTimer::SlideMinDuration);
     SlideTimeRemaining = 0.0f;
     
     // Return to walking movement mode if on ground
@@ -1042,8 +1199,7 @@ void URMCMovementComponent::EndSlide()
     }
     
     // Broadcast events
-    OnSlideEnd.Broadcast();
-    OnSlideEnd_BP();
+    BroadcastSlideEnd();
 }
 
 bool URMCMovementComponent::CanSlide() const
@@ -1071,73 +1227,15 @@ bool URMCMovementComponent::CanSlide() const
 
 void URMCMovementComponent::ApplySlideForces(float DeltaTime)
 {
-    // Apply friction to slow down over time using the configurable friction value
-    FVector SlideDirection = Velocity.GetSafeNormal2D();
-    float CurrentSpeed = Velocity.Size2D();
-    float NewSpeed = FMath::Max(CurrentSpeed - (SlideFriction * CurrentSpeed * DeltaTime), SlideMinSpeed);
-    
-    // Apply gravity component along slope
-    FVector FloorNormal = CurrentFloor.HitResult.Normal;
-    float FloorDot = FVector::DotProduct(FloorNormal, FVector(0, 0, 1));
-    FVector fGravityDirection = FVector(0, 0, -1) - FloorNormal * FloorDot;
-    
-    // If on a slope, accelerate downhill using the configurable multiplier
-    if (FloorDot < 0.9999f) // Not completely flat
-    {
-        FVector DownhillDirection = fGravityDirection.GetSafeNormal();
-        float DownhillComponent = FVector::DotProduct(SlideDirection, DownhillDirection);
-        
-        // If sliding downhill, add acceleration
-        if (DownhillComponent > 0)
-        {
-            // Use the configurable downhill acceleration multiplier
-            NewSpeed += 500.0f * DownhillComponent * SlideDownhillAccelerationMultiplier * DeltaTime;
-        }
-    }
-    
     // Allow some control for the player
+    FVector InputVector = FVector::ZeroVector;
     ACharacter* Character = Cast<ACharacter>(GetOwner());
     if (Character)
     {
-        FVector InputVector = ConsumeInputVector();
-        SlideDirection = FMath::VInterpTo(
-            SlideDirection,
-            (SlideDirection + InputVector * 0.5f).GetSafeNormal(),
-            DeltaTime,
-            2.0f
-        );
+        InputVector = ConsumeInputVector();
     }
     
-    // Set new velocity, capped at the configurable slide speed
-    Velocity = SlideDirection * FMath::Min(NewSpeed, SlideSpeed);
-}
-
-void URMCMovementComponent::UpdateSlideTime(float DeltaTime)
-{
-    if (bIsSliding)
-    {
-        SlideTimeRemaining -= DeltaTime;
-        
-        // End slide if minimum duration has passed and player isn't providing input
-        if (SlideTimeRemaining <= (SlideMaxDuration - SlideMinDuration))
-        {
-            ACharacter* Character = Cast<ACharacter>(GetOwner());
-            if (Character)
-            {
-                FVector InputVector = ConsumeInputVector();
-                if (InputVector.SizeSquared() < 0.1f)
-                {
-                    EndSlide();
-                }
-            }
-        }
-        
-        // End slide if maximum duration has passed
-        if (SlideTimeRemaining <= 0)
-        {
-            EndSlide();
-        }
-    }
+    Velocity = FRMCMovementSimulation::ApplySlideForces(MakeMovementParams(), Velocity, CurrentFloor.HitResult.Normal, InputVector, DeltaTime);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1186,48 +1284,17 @@ bool URMCMovementComponent::PerformDash()
     Velocity = DashDirection * DashSpeed;
     
     // Start dash timeout
-    GetWorld()->GetTimerManager().SetTimer(
-        TimerHandle_DashTimeout,
-        [this]() {
-            bIsDashing = false;
-            
-            // Apply speed boost after dash
-            if (IsMovingOnGround())
-            {
-                Velocity += DashDirection * DashGroundSpeedBoost;
-            }
-            else
-            {
-                Velocity += DashDirection * DashAirSpeedBoost;
-            }
-            
-            // Return to appropriate movement mode
-            if (IsMovingOnGround())
-            {
-                SetMovementMode(MOVE_Walking);
-            }
-            else
-            {
-                SetMovementMode(MOVE_Falling);
-            }
-            
-            // Broadcast events
-            OnDashEnd.Broadcast();
-            OnDashEnd_BP();
-        },
-        DashDuration,
-        false
-    );
+    MovementTimers.Set(ERMCMovementTimer::Dash, DashDuration);
     
     // Set cooldown
+    MovementTimers.Set(ERMCMovementTimer::DashCooldown, DashCooldown);
     DashCooldownRemaining = DashCooldown;
     
     // Add momentum
     AddMomentum(20.0f);
     
     // Broadcast events
-    OnDashBegin.Broadcast(DashDirection);
-    OnDashBegin_BP(DashDirection); // Using DashDir parameter name in BP event
+    BroadcastDashBegin(DashDirection);
     
     return true;
 }
@@ -1235,7 +1302,7 @@ bool URMCMovementComponent::PerformDash()
 bool URMCMovementComponent::CanDash() const
 {
     // Check cooldown
-    if (DashCooldownRemaining > 0)
+    if (MovementTimers.IsActive(ERMCMovementTimer::DashCooldown))
     {
         return false;
     }
@@ -1268,20 +1335,41 @@ float URMCMovementComponent::GetDashCooldownPercent() const
 void URMCMovementComponent::ApplyDashForces(float DeltaTime)
 {
     // During dash, maintain constant velocity in dash direction
-    float DashSpeed = DashDistance / DashDuration;
-    Velocity = DashDirection * DashSpeed;
+    Velocity = FRMCMovementSimulation::ApplyDashForces(MakeMovementParams(), DashDirection);
 }
 
-void URMCMovementComponent::UpdateDashCooldown(float DeltaTime)
+void URMCMovementComponent::EndDash()
 {
-    if (DashCooldownRemaining > 0)
+    if (!bIsDashing)
     {
-        DashCooldownRemaining -= DeltaTime;
-        if (DashCooldownRemaining < 0)
-        {
-            DashCooldownRemaining = 0;
-        }
+        return;
+    }
+
+    bIsDashing = false;
+    MovementTimers.Clear(ERMCMovementTimer::Dash);
+    
+    // Apply speed boost after dash
+    if (IsMovingOnGround())
+    {
+        Velocity += DashDirection * DashGroundSpeedBoost;
+    }
+    else
+    {
+        Velocity += DashDirection * DashAirSpeedBoost;
     }
+    
+    // Return to appropriate movement mode
+    if (IsMovingOnGround())
+    {
+        SetMovementMode(MOVE_Walking);
+    }
+    else
+    {
+        SetMovementMode(MOVE_Falling);
+    }
+    
+    // Broadcast events
+    BroadcastDashEnd();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1304,7 +1392,10 @@ bool URMCMovementComponent::PerformDoubleJump()
     AddMomentum(10.0f);
     
     // Broadcast event
-    OnDoubleJump_BP();
+    if (bScriptDoubleJump)
+    {
+        OnDoubleJump_BP();
+    }
     
     return true;
 }
@@ -1346,21 +1437,66 @@ void URMCMovementComponent::ResetJumpState()
 
 void URMCMovementComponent::UpdateMomentum(float DeltaTime)
 {
-    float PreviousMomentum = CurrentMomentum;
-    
-    // Build momentum when moving at high speeds
-    if (Velocity.SizeSquared() > FMath::Square(MaxWalkSpeed * 1.2f))
+    // Build momentum when moving at high speeds, decay it when moving slowly or not moving.
+    // Skip the Blueprint thunk when the class doesn't override the interface functions.
+    const float MomentumDelta = FRMCMovementSimulation::ComputeMomentumDelta(MakeMovementParams(), Velocity, DeltaTime);
+    if (MomentumDelta > 0.0f)
+    {
+        if (bScriptAddMomentum)
+        {
+            AddMomentum(MomentumDelta);
+        }
+        else
+        {
+            AddMomentum_Implementation(MomentumDelta);
+        }
+    }
+    else if (MomentumDelta < 0.0f)
     {
-        AddMomentum(MomentumBuildRate * DeltaTime);
+        if (bScriptReduceMomentum)
+        {
+            ReduceMomentum(-MomentumDelta);
+        }
+        else
+        {
+            ReduceMomentum_Implementation(-MomentumDelta);
+        }
     }
-    // Decay momentum when moving slowly or not moving
-    else if (Velocity.SizeSquared() < FMath::Square(MaxWalkSpeed * 0.5f))
+}
+
+void URMCMovementComponent::BroadcastMomentumChanged(bool bForce)
+{
+    if (bSuppressMovementEvents || CurrentMomentum == LastBroadcastMomentum)
     {
-        ReduceMomentum(MomentumDecayRate * DeltaTime);
+        return;
     }
-    
-    // Broadcast momentum changed event if it changed significantly
-    if (FMath::Abs(PreviousMomentum - CurrentMomentum) > 0.1f)
+
+    const UWorld* World = GetWorld();
+    const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+    if (!bForce)
+    {
+        // Hitting either end of the range is always worth reporting
+        const bool bAtLimit = CurrentMomentum <= 0.0f || CurrentMomentum >= MaxMomentum;
+        if (!bAtLimit)
+        {
+            if (FMath::Abs(CurrentMomentum - LastBroadcastMomentum) < MomentumBroadcastQuantum)
+            {
+                return;
+            }
+
+            if (Now - LastMomentumBroadcastTime < MomentumBroadcastMinInterval)
+            {
+                return;
+            }
+        }
+    }
+
+    LastBroadcastMomentum = CurrentMomentum;
+    LastMomentumBroadcastTime = Now;
+
+    OnMomentumChangedNative.Broadcast(CurrentMomentum);
+    if (OnMomentumChanged.IsBound())
     {
         OnMomentumChanged.Broadcast(CurrentMomentum);
     }
@@ -1371,6 +1507,260 @@ float URMCMovementComponent::GetMomentumPercentage() const
     return FMath::Clamp(CurrentMomentum / MaxMomentum, 0.0f, 1.0f);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Trajectory Prediction
+
+ERMCPredictedMovementMode URMCMovementComponent::GetPredictedMovementMode() const
+{
+    if (bIsWallRunning)
+    {
+        return ERMCPredictedMovementMode::WallRunning;
+    }
+    if (bIsSliding)
+    {
+        return ERMCPredictedMovementMode::Sliding;
+    }
+    if (bIsDashing)
+    {
+        return ERMCPredictedMovementMode::Dashing;
+    }
+    if (IsFalling())
+    {
+        return ERMCPredictedMovementMode::Falling;
+    }
+    return ERMCPredictedMovementMode::Walking;
+}
+
+ERMCPredictedMovementMode URMCMovementComponent::GetPredictedMovementModeFromNetwork(uint8 NetworkMovementMode) const
+{
+    TEnumAsByte<EMovementMode> NetMode;
+    TEnumAsByte<EMovementMode> NetGroundMode;
+    uint8 NetCustomMode = 0;
+    UnpackNetworkMovementMode(NetworkMovementMode, NetMode, NetCustomMode, NetGroundMode);
+
+    if (NetMode == MOVE_Custom)
+    {
+        switch (NetCustomMode)
+        {
+        case CMOVE_WallRunning:
+            return ERMCPredictedMovementMode::WallRunning;
+        case CMOVE_Sliding:
+            return ERMCPredictedMovementMode::Sliding;
+        case CMOVE_Dashing:
+            return ERMCPredictedMovementMode::Dashing;
+        default:
+            break;
+        }
+    }
+
+    return NetMode == MOVE_Falling ? ERMCPredictedMovementMode::Falling : ERMCPredictedMovementMode::Walking;
+}
+
+FRMCTrajectoryState URMCMovementComponent::MakeTrajectoryState() const
+{
+    FRMCTrajectoryState State;
+    State.Location = UpdatedComponent ? UpdatedComponent->GetComponentLocation() : FVector::ZeroVector;
+    State.Velocity = Velocity;
+    State.Mode = GetPredictedMovementMode();
+
+    // Same requirements as CanDoubleJump, minus the falling check since other modes end in a fall
+    State.bCanDoubleJump = !bHasDoubleJumped && CurrentMomentum >= MaxMomentum * 0.2f;
+    State.DoubleJumpZVelocity = DoubleJumpZVelocity;
+
+    State.WallRunDirection = GetWallRunDirection();
+    State.WallRunSpeed = WallRunSpeed;
+    State.WallRunTimeRemaining = WallRunTimeRemaining;
+
+    State.SlideSpeed = SlideSpeed;
+    State.SlideFriction = SlideFriction;
+    State.SlideMinSpeed = SlideMinSpeed;
+    State.SlideTimeRemaining = SlideTimeRemaining;
+
+    State.DashDirection = DashDirection;
+    State.DashSpeed = (DashDuration > 0.0f) ? DashDistance / DashDuration : 0.0f;
+    // The dash timeout runs while still in the custom mode, so it always applies the air boost
+    State.DashExitSpeedBoost = DashAirSpeedBoost;
+    if (bIsDashing)
+    {
+        State.DashTimeRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::Dash);
+    }
+
+    State.GravityZ = GetGravityZ();
+    State.GlobalSpeedCap = GlobalSpeedCap;
+
+    return State;
+}
+
+int32 URMCMovementComponent::PredictTrajectory(float Seconds, int32 SampleCount, TArrayView<FRMCTrajectorySample> OutSamples, bool bAssumeDoubleJump) const
+{
+    return FRMCTrajectoryPredictor::Predict(MakeTrajectoryState(), Seconds, SampleCount, OutSamples, bAssumeDoubleJump);
+}
+
+int32 URMCMovementComponent::PredictTrajectories(TArrayView<const URMCMovementComponent* const> Components, float Seconds, int32 SampleCount,
+    TArrayView<FRMCTrajectorySample> OutSamples, bool bAssumeDoubleJump)
+{
+    if (SampleCount <= 0 || OutSamples.Num() < Components.Num() * SampleCount)
+    {
+        return 0;
+    }
+
+    int32 NumWritten = 0;
+    for (int32 Index = 0; Index < Components.Num(); ++Index)
+    {
+        TArrayView<FRMCTrajectorySample> Row = OutSamples.Slice(Index * SampleCount, SampleCount);
+        if (const URMCMovementComponent* Component = Components[Index])
+        {
+            NumWritten += Component->PredictTrajectory(Seconds, SampleCount, Row, bAssumeDoubleJump);
+        }
+        else
+        {
+            // Keep the row layout intact for missing components
+            for (FRMCTrajectorySample& Sample : Row)
+            {
+                Sample = FRMCTrajectorySample();
+            }
+        }
+    }
+
+    return NumWritten;
+}
+
+void URMCMovementComponent::GetPredictedTrajectory(float Seconds, int32 SampleCount, bool bAssumeDoubleJump, TArray<FRMCTrajectorySample>& OutSamples) const
+{
+    OutSamples.SetNumUninitialized(FMath::Max(SampleCount, 0), EAllowShrinking::No);
+    const int32 NumWritten = PredictTrajectory(Seconds, SampleCount, OutSamples, bAssumeDoubleJump);
+    OutSamples.SetNum(NumWritten, EAllowShrinking::No);
+}
+
+FVector URMCMovementComponent::PredictLocationAtTime(float Seconds, bool bAssumeDoubleJump) const
+{
+    return FRMCTrajectoryPredictor::Evaluate(MakeTrajectoryState(), Seconds, bAssumeDoubleJump).Location;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Batched Bookkeeping
+
+void URMCMovementComponent::UpdateBookkeepingBatched(TArrayView<URMCMovementComponent* const> Components, float DeltaTime, FRMCMovementBookkeepingBatch& Scratch)
+{
+    // Gather the participating components
+    TArray<URMCMovementComponent*, TInlineAllocator<256>> Active;
+    for (URMCMovementComponent* Component : Components)
+    {
+        // Proxies take their momentum and timers from the server, as in ApplyPostMovementRules
+        if (IsValid(Component) && Component->IsBookkeepingBatched() && Component->IsActive() && !Component->IsReplicatedProxy())
+        {
+            Active.Add(Component);
+        }
+    }
+
+    const int32 NumAgents = Active.Num();
+    if (NumAgents == 0)
+    {
+        return;
+    }
+
+    Scratch.SetNum(NumAgents);
+    for (int32 Index = 0; Index < NumAgents; ++Index)
+    {
+        const URMCMovementComponent* Component = Active[Index];
+
+        Scratch.VelocityX[Index] = Component->Velocity.X;
+        Scratch.VelocityY[Index] = Component->Velocity.Y;
+        Scratch.VelocityZ[Index] = Component->Velocity.Z;
+
+        Scratch.Momentum[Index] = Component->CurrentMomentum;
+        Scratch.MaxMomentum[Index] = Component->MaxMomentum;
+        Scratch.MomentumBuildRate[Index] = Component->MomentumBuildRate;
+        Scratch.MomentumDecayRate[Index] = Component->MomentumDecayRate;
+        Scratch.MaxWalkSpeed[Index] = Component->MaxWalkSpeed;
+
+        Scratch.SpeedCap[Index] = Component->GlobalSpeedCap;
+        Scratch.SpeedCapDamping[Index] = Component->SpeedCapDamping;
+
+        Scratch.Flags[Index] = Component->bApplySpeedCapToZVelocity ? ERMCBookkeepingFlags::SpeedCapZ : 0;
+    }
+
+    Scratch.Update(DeltaTime);
+
+    // Write back
+    for (int32 Index = 0; Index < NumAgents; ++Index)
+    {
+        URMCMovementComponent* Component = Active[Index];
+
+        Component->Velocity = FVector(Scratch.VelocityX[Index], Scratch.VelocityY[Index], Scratch.VelocityZ[Index]);
+        Component->CurrentMomentum = Scratch.Momentum[Index];
+    }
+
+    // Timers next. An expiry ends its ability on the spot, with that ability's own events.
+    for (URMCMovementComponent* Component : Active)
+    {
+        Component->AdvanceMovementTimers(DeltaTime);
+    }
+
+    // Then fire momentum events
+    for (URMCMovementComponent* Component : Active)
+    {
+        Component->BroadcastMomentumChanged();
+        Component->MarkReplicatedStateDirty();
+    }
+}
+
+bool URMCMovementComponent::IsBookkeepingBatched() const
+{
+    if (!bUseBatchedBookkeeping || !bRegisteredForBatchedBookkeeping || !IsComponentTickEnabled())
+    {
+        return false;
+    }
+
+    // The kernel writes momentum straight back, so Blueprint overrides of AddMomentum / ReduceMomentum need the per-component path
+    if (bScriptAddMomentum || bScriptReduceMomentum)
+    {
+        return false;
+    }
+
+    // The batch runs every frame, so a component on a reduced LOD tick interval keeps its own cadence
+    if (PrimaryComponentTick.TickInterval > 0.0f)
+    {
+        return false;
+    }
+
+    // Only the per-component speed cap reports on screen
+    const ARMCCharacter* RMCCharacter = Cast<ARMCCharacter>(CharacterOwner);
+    return !RMCCharacter || !RMCCharacter->bDebugModeEnabled;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Movement LOD
+
+void URMCMovementComponent::SetMovementLOD(ERMCMovementLOD NewLOD)
+{
+    if (NewLOD == MovementLOD)
+    {
+        return;
+    }
+
+    MovementLOD = NewLOD;
+    LastWallProbeTime = -1.0;
+
+    switch (NewLOD)
+    {
+    case ERMCMovementLOD::Reduced:
+        SetComponentTickInterval(ReducedLODTickInterval);
+        break;
+
+    case ERMCMovementLOD::Minimal:
+    case ERMCMovementLOD::Dormant:
+        SetComponentTickInterval(MinimalLODTickInterval);
+        break;
+
+    default:
+        SetComponentTickInterval(0.0f);
+        break;
+    }
+
+    SetComponentTickEnabled(NewLOD != ERMCMovementLOD::Dormant);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Debug Helper Functions
 
@@ -1659,6 +2049,952 @@ void URMCMovementComponent::SetSpeedCapSettings(float NewSpeedCap, float NewDamp
         GlobalSpeedCap, SpeedCapDamping, bApplySpeedCapToZVelocity ? TEXT("True") : TEXT("False"));
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Movement Timers
+
+void URMCMovementComponent::SetMovementTimer(uint8 TimerId, float Duration)
+{
+    MovementTimers.Set(TimerId, Duration);
+}
+
+void URMCMovementComponent::ClearMovementTimer(uint8 TimerId)
+{
+    MovementTimers.Clear(TimerId);
+}
+
+float URMCMovementComponent::GetMovementTimerRemaining(uint8 TimerId) const
+{
+    return MovementTimers.GetRemaining(TimerId);
+}
+
+void URMCMovementComponent::AdvanceMovementTimers(float DeltaTime)
+{
+    MovementTimers.Advance(DeltaTime, [this](uint8 TimerId)
+    {
+        OnMovementTimerExpired(TimerId);
+    });
+
+    DashCooldownRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::DashCooldown);
+    WallRunTimeRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::WallRun);
+    SlideTimeRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::Slide);
+}
+
+void URMCMovementComponent::OnMovementTimerExpired(uint8 TimerId)
+{
+    switch (static_cast<ERMCMovementTimer>(TimerId))
+    {
+    case ERMCMovementTimer::Dash:
+        EndDash();
+        break;
+
+    case ERMCMovementTimer::WallRun:
+        EndWallRun();
+        break;
+
+    case ERMCMovementTimer::Slide:
+        EndSlide();
+        break;
+
+    default:
+        // Cooldowns and the slide minimum just lapse
+        break;
+    }
+
+    OnMovementTimerExpiredNative.Broadcast(TimerId);
+}
+
+void URMCMovementComponent::ShortenMovementTimer(ERMCMovementTimer Timer, float DeltaTime)
+{
+    if (!MovementTimers.IsActive(Timer))
+    {
+        return;
+    }
+
+    const float Remaining = MovementTimers.GetRemaining(Timer) - DeltaTime;
+    if (Remaining > 0.0f)
+    {
+        MovementTimers.Set(Timer, Remaining);
+    }
+    else
+    {
+        MovementTimers.Clear(Timer);
+        OnMovementTimerExpired(static_cast<uint8>(Timer));
+    }
+
+    DashCooldownRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::DashCooldown);
+    WallRunTimeRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::WallRun);
+    SlideTimeRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::Slide);
+}
+
+void URMCMovementComponent::UpdateDashCooldown(float DeltaTime)
+{
+    ShortenMovementTimer(ERMCMovementTimer::DashCooldown, DeltaTime);
+}
+
+void URMCMovementComponent::UpdateWallRunTime(float DeltaTime)
+{
+    ShortenMovementTimer(ERMCMovementTimer::WallRun, DeltaTime);
+}
+
+void URMCMovementComponent::UpdateSlideTime(float DeltaTime)
+{
+    // The minimum duration first, so it lapses before a maximum that runs out in the same call
+    ShortenMovementTimer(ERMCMovementTimer::SlideMinDuration, DeltaTime);
+    ShortenMovementTimer(ERMCMovementTimer::Slide, DeltaTime);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Replication
+
+void URMCMovementComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    // Push based, so the server only compares these after MarkReplicatedStateDirty says they changed.
+    // The owning client predicts its own state.
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    Params.Condition = COND_SkipOwner;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(URMCMovementComponent, bIsWallRunning, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(URMCMovementComponent, bIsSliding, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(URMCMovementComponent, bIsDashing, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(URMCMovementComponent, ReplicatedMomentum, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(URMCMovementComponent, ReplicatedWallNormalYaw, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(URMCMovementComponent, ReplicatedDashYaw, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(URMCMovementComponent, PhysicsProfileIndex, Params);
+}
+
+// Horizontal direction to and from a yaw in 1/256 turns
+static uint8 QuantizeDirectionYaw(const FVector& Direction)
+{
+    const float Yaw = FMath::RadiansToDegrees(FMath::Atan2(Direction.Y, Direction.X));
+    return static_cast<uint8>(FMath::RoundToInt(Yaw * (256.0f / 360.0f)) & 0xFF);
+}
+
+static FVector DequantizeDirectionYaw(uint8 QuantizedYaw)
+{
+    return FRotator(0.0f, QuantizedYaw * (360.0f / 256.0f), 0.0f).Vector();
+}
+
+void URMCMovementComponent::MarkReplicatedStateDirty()
+{
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    bool bModeChanged = false;
+
+    if (bIsWallRunning != bLastReplicatedWallRunning)
+    {
+        bLastReplicatedWallRunning = bIsWallRunning;
+        MARK_PROPERTY_DIRTY_FROM_NAME(URMCMovementComponent, bIsWallRunning, this);
+        bModeChanged = true;
+    }
+
+    if (bIsSliding != bLastReplicatedSliding)
+    {
+        bLastReplicatedSliding = bIsSliding;
+        MARK_PROPERTY_DIRTY_FROM_NAME(URMCMovementComponent, bIsSliding, this);
+        bModeChanged = true;
+    }
+
+    if (bIsDashing != bLastReplicatedDashing)
+    {
+        bLastReplicatedDashing = bIsDashing;
+        MARK_PROPERTY_DIRTY_FROM_NAME(URMCMovementComponent, bIsDashing, this);
+        bModeChanged = true;
+    }
+
+    if (bModeChanged)
+    {
+        BoostNetUpdateFrequency();
+    }
+
+    const uint8 QuantizedMomentum = static_cast<uint8>(FMath::RoundToInt(GetMomentumPercentage() * 255.0f));
+    if (QuantizedMomentum != ReplicatedMomentum)
+    {
+        ReplicatedMomentum = QuantizedMomentum;
+        MARK_PROPERTY_DIRTY_FROM_NAME(URMCMovementComponent, ReplicatedMomentum, this);
+    }
+
+    // Only meaningful during their modes, so left alone outside them to avoid dirtying on every change
+    if (bIsWallRunning)
+    {
+        const uint8 QuantizedWallNormal = QuantizeDirectionYaw(CurrentWallNormal);
+        if (QuantizedWallNormal != ReplicatedWallNormalYaw)
+        {
+            ReplicatedWallNormalYaw = QuantizedWallNormal;
+            MARK_PROPERTY_DIRTY_FROM_NAME(URMCMovementComponent, ReplicatedWallNormalYaw, this);
+        }
+    }
+
+    if (bIsDashing)
+    {
+        const uint8 QuantizedDashDirection = QuantizeDirectionYaw(DashDirection);
+        if (QuantizedDashDirection != ReplicatedDashYaw)
+        {
+            ReplicatedDashYaw = QuantizedDashDirection;
+            MARK_PROPERTY_DIRTY_FROM_NAME(URMCMovementComponent, ReplicatedDashYaw, this);
+        }
+    }
+}
+
+void URMCMovementComponent::OnRep_ReplicatedMomentum()
+{
+    CurrentMomentum = ReplicatedMomentum / 255.0f * MaxMomentum;
+    BroadcastMomentumChanged();
+}
+
+bool URMCMovementComponent::IsReplicatedProxy() const
+{
+    if (!CharacterOwner || CharacterOwner->GetLocalRole() != ROLE_SimulatedProxy)
+    {
+        return false;
+    }
+
+    const ARMCCharacter* RMCCharacter = Cast<ARMCCharacter>(CharacterOwner);
+    return !RMCCharacter || !RMCCharacter->IsRollbackControlled();
+}
+
+void URMCMovementComponent::OnRep_PhysicsProfileIndex()
+{
+    ApplyPhysicsProfileIndex(PhysicsProfileIndex);
+}
+
+void URMCMovementComponent::ClientSetPhysicsProfileIndex_Implementation(uint8 Index)
+{
+    ApplyPhysicsProfileIndex(Index);
+}
+
+void URMCMovementComponent::ApplyClientMovePhysicsProfile(uint8 Index)
+{
+    // Moves the client made before it heard about a server switch keep the server's profile
+    if (bAwaitingClientPhysicsProfile)
+    {
+        bAwaitingClientPhysicsProfile = Index != PhysicsProfileIndex;
+        return;
+    }
+
+    if (Index == PhysicsProfileIndex)
+    {
+        return;
+    }
+
+    // The move data is the client's word, so it only picks among the profiles it has been granted
+    if (Index == 0 || Index > PhysicsProfiles.Num() || !ClientSelectablePhysicsProfiles.Contains(PhysicsProfiles[Index - 1].ProfileName))
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("%s: client move with physics profile %d it may not select, restoring %d"),
+            *GetNameSafe(CharacterOwner), Index, PhysicsProfileIndex);
+        bAwaitingClientPhysicsProfile = true;
+        ClientSetPhysicsProfileIndex(PhysicsProfileIndex);
+        return;
+    }
+
+    ApplyPhysicsProfileIndex(Index);
+}
+
+FNetworkPredictionData_Client* URMCMovementComponent::GetPredictionData_Client() const
+{
+    if (!ClientPredictionData)
+    {
+        ClientPredictionData = new FNetworkPredictionData_Client_RMC(*this);
+    }
+
+    return ClientPredictionData;
+}
+
+bool URMCMovementComponent::ClientUpdatePositionAfterServerUpdate()
+{
+    // Replayed moves switch to the profile each was made with, so end on the one in use before the replay
+    const uint8 CurrentPhysicsProfileIndex = PhysicsProfileIndex;
+    const bool bResult = Super::ClientUpdatePositionAfterServerUpdate();
+    if (PhysicsProfileIndex != CurrentPhysicsProfileIndex)
+    {
+        const bool bWasSuppressingEvents = bSuppressMovementEvents;
+        bSuppressMovementEvents = true;
+        ApplyPhysicsProfileIndex(CurrentPhysicsProfileIndex);
+        bSuppressMovementEvents = bWasSuppressingEvents;
+    }
+
+    return bResult;
+}
+
+void URMCMovementComponent::OnRep_IsSliding()
+{
+    ApplyProxySlideCapsule();
+}
+
+void URMCMovementComponent::OnRep_ReplicatedWallNormal()
+{
+    CurrentWallNormal = DequantizeDirectionYaw(ReplicatedWallNormalYaw);
+}
+
+void URMCMovementComponent::OnRep_ReplicatedDashDirection()
+{
+    DashDirection = DequantizeDirectionYaw(ReplicatedDashYaw);
+}
+
+void URMCMovementComponent::ApplyProxySlideCapsule()
+{
+    if (!IsReplicatedProxy())
+    {
+        return;
+    }
+
+    // Sized from the class default rather than the current height, so it holds however the flag and
+    // mode updates interleave, and when a replay scrubs straight into or out of a slide
+    const ACharacter* DefaultCharacter = CharacterOwner->GetClass()->GetDefaultObject<ACharacter>();
+    const float DefaultHalfHeight = DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+    CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(bIsSliding ? DefaultHalfHeight * SlideCapsuleHeightScale : DefaultHalfHeight);
+}
+
+void URMCMovementComponent::BoostNetUpdateFrequency()
+{
+    AActor* Owner = GetOwner();
+    UWorld* World = GetWorld();
+    if (!bAdaptiveNetUpdateFrequency || !Owner || !World || GetOwnerRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    NetUpdateBoostEndTime = World->GetTimeSeconds() + NetUpdateBoostDuration;
+    Owner->NetUpdateFrequency = MaxNetUpdateFrequency;
+    Owner->ForceNetUpdate();
+}
+
+void URMCMovementComponent::UpdateNetUpdateFrequency()
+{
+    AActor* Owner = GetOwner();
+    UWorld* World = GetWorld();
+    if (!bAdaptiveNetUpdateFrequency || !Owner || !World || GetOwnerRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    // Special modes and recent transitions stay at the maximum rate
+    float TargetFrequency = MaxNetUpdateFrequency;
+    const bool bBoosted = bIsWallRunning || bIsSliding || bIsDashing || World->GetTimeSeconds() < NetUpdateBoostEndTime;
+    if (!bBoosted)
+    {
+        if (IsMovingOnGround() && Velocity.IsNearlyZero(10.0f) && Acceleration.IsNearlyZero())
+        {
+            TargetFrequency = IdleNetUpdateFrequency;
+        }
+        else if (HighSpeedNetUpdateThreshold > 0.0f)
+        {
+            const float SpeedAlpha = FMath::Clamp(Velocity.Size() / HighSpeedNetUpdateThreshold, 0.0f, 1.0f);
+            TargetFrequency = FMath::Lerp(IdleNetUpdateFrequency, MaxNetUpdateFrequency, SpeedAlpha);
+        }
+    }
+
+    // Ignore small changes so the rate isn't rewritten every frame
+    if (FMath::Abs(Owner->NetUpdateFrequency - TargetFrequency) >= 1.0f)
+    {
+        Owner->NetUpdateFrequency = TargetFrequency;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Simulated Proxies
+
+void URMCMovementComponent::MoveSmooth(const FVector& InVelocity, const float DeltaSeconds, FStepDownResult* OutStepDownResult)
+{
+    // Walking and falling proxies are handled well by the default constant-velocity path
+    if (!bModeAwareProxySimulation || MovementMode != MOVE_Custom || !CharacterOwner || CharacterOwner->GetLocalRole() != ROLE_SimulatedProxy)
+    {
+        Super::MoveSmooth(InVelocity, DeltaSeconds, OutStepDownResult);
+        return;
+    }
+
+    ProxyModeElapsedTime += DeltaSeconds;
+
+    const FRMCTrajectorySample Sample = FRMCTrajectoryPredictor::Evaluate(MakeProxyTrajectoryState(), DeltaSeconds);
+    const FVector Delta = Sample.Location - UpdatedComponent->GetComponentLocation();
+    Velocity = Sample.Velocity;
+
+    FHitResult Hit(1.0f);
+    SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+    if (Hit.IsValidBlockingHit())
+    {
+        SlideAlongSurface(Delta, 1.0f - Hit.Time, Hit.Normal, Hit, false);
+    }
+}
+
+FRMCTrajectoryState URMCMovementComponent::MakeProxyTrajectoryState() const
+{
+    FRMCTrajectoryState State = MakeTrajectoryState();
+
+    // The replicated mode is authoritative. The mode timers are not replicated, so time the mode from when
+    // the proxy entered it. The wall run follows the replicated velocity along the replicated wall.
+    switch (CustomMovementMode)
+    {
+    case CMOVE_WallRunning:
+        State.Mode = ERMCPredictedMovementMode::WallRunning;
+        State.WallRunDirection = FVector::VectorPlaneProject(Velocity, CurrentWallNormal).GetSafeNormal2D();
+        State.WallRunSpeed = Velocity.Size2D();
+        State.WallRunTimeRemaining = MaxWallRunTime - ProxyModeElapsedTime;
+        break;
+
+    case CMOVE_Sliding:
+        State.Mode = ERMCPredictedMovementMode::Sliding;
+        State.SlideTimeRemaining = SlideMaxDuration - ProxyModeElapsedTime;
+        break;
+
+    case CMOVE_Dashing:
+        State.Mode = ERMCPredictedMovementMode::Dashing;
+        State.DashDirection = DashDirection.IsNearlyZero() ? Velocity.GetSafeNormal() : DashDirection;
+        State.DashSpeed = Velocity.Size();
+        State.DashTimeRemaining = DashDuration - ProxyModeElapsedTime;
+        break;
+
+    default:
+        break;
+    }
+
+    return State;
+}
+
+void URMCMovementComponent::UpdateProxySmoothing()
+{
+    float SmoothLocationTime = DefaultProxySmoothLocationTime;
+    if (bModeAwareProxySimulation && MovementMode == MOVE_Custom)
+    {
+        switch (CustomMovementMode)
+        {
+        case CMOVE_WallRunning:
+            SmoothLocationTime = WallRunProxySmoothLocationTime;
+            break;
+
+        case CMOVE_Sliding:
+            SmoothLocationTime = SlideProxySmoothLocationTime;
+            break;
+
+        case CMOVE_Dashing:
+            SmoothLocationTime = DashProxySmoothLocationTime;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    NetworkSimulatedSmoothLocationTime = SmoothLocationTime;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Client-Authoritative Movement
+
+void URMCMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel)
+{
+    FRMCMovementTimingScope TimingScope;
+
+    bLastMoveClientAuthoritative = false;
+
+    const FCharacterNetworkMoveData* MoveData = GetCurrentNetworkMoveData();
+
+    // Switch profile at the same step the client did. Every move in our container is an FRMCCharacterNetworkMoveData.
+    if (MoveData && CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_Authority)
+    {
+        ApplyClientMovePhysicsProfile(static_cast<const FRMCCharacterNetworkMoveData*>(MoveData)->PhysicsProfileIndex);
+    }
+
+    if (!bClientAuthoritativeMovement || !MoveData || !CharacterOwner || CharacterOwner->GetLocalRole() != ROLE_Authority)
+    {
+        Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+        return;
+    }
+
+    // A position relative to a moving base depends on where the server has the base, so simulate those
+    if (!MovementBaseUtility::UseRelativeLocation(MoveData->MovementBase)
+        && IsWithinMovementEnvelope(MoveData->Location, MoveData->MovementMode, DeltaTime)
+        && ApplyClientAuthoritativeMove(MoveData->Location, MoveData->MovementMode, DeltaTime))
+    {
+        bLastMoveClientAuthoritative = true;
+        ++ClientAuthMovesAccepted;
+        return;
+    }
+
+    // Outside the envelope or through geometry: simulate the move, and ServerCheckClientError corrects the client if it disagrees
+    ++ClientAuthMovesRejected;
+    UE_LOG(LogTemp, Verbose, TEXT("%s: client move outside the movement envelope or blocked, simulating it"), *GetNameSafe(CharacterOwner));
+    Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+}
+
+bool URMCMovementComponent::ServerCheckClientError(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FVector& ClientWorldLocation,
+    const FVector& RelativeClientLocation, UPrimitiveComponent* ClientMovementBase, FName ClientBaseBoneName, uint8 ClientMovementMode)
+{
+    // The server took the client's position, so there is nothing to correct
+    if (bLastMoveClientAuthoritative)
+    {
+        CorrectionStats.Record(GetPredictedMovementMode(), false, 0.0f);
+        return false;
+    }
+
+    const bool bCorrect = Super::ServerCheckClientError(ClientTimeStamp, DeltaTime, Accel, ClientWorldLocation, RelativeClientLocation,
+        ClientMovementBase, ClientBaseBoneName, ClientMovementMode);
+
+    CorrectionStats.Record(GetPredictedMovementMode(), bCorrect, FVector::Dist(ClientWorldLocation, UpdatedComponent->GetComponentLocation()));
+    return bCorrect;
+}
+
+bool URMCMovementComponent::IsWithinMovementEnvelope(const FVector& ClientLocation, uint8 ClientMovementMode, float DeltaTime)
+{
+    if (DeltaTime <= 0.0f || !UpdatedComponent)
+    {
+        return false;
+    }
+
+    // A false positive only costs a simulated move; a legitimate client isn't corrected by it
+    const float Tolerance = FMath::Max(ClientAuthEnvelopeTolerance, 1.0f);
+    const FVector Delta = ClientLocation - UpdatedComponent->GetComponentLocation();
+    const float HorizontalDistance = Delta.Size2D();
+
+    // The dash budget refills with simulated time whether or not this move passes
+    const float BudgetRefill = DashCooldown > 0.0f ? DashDistance / DashCooldown * DeltaTime : DashDistance;
+    ClientAuthDashBudget = FMath::Min(ClientAuthDashBudget + BudgetRefill, DashDistance * Tolerance);
+
+    TEnumAsByte<EMovementMode> ClientMode;
+    TEnumAsByte<EMovementMode> ClientGroundMode;
+    uint8 ClientCustomMode = 0;
+    UnpackNetworkMovementMode(ClientMovementMode, ClientMode, ClientCustomMode, ClientGroundMode);
+    const bool bClientWallRunning = ClientMode == MOVE_Custom && ClientCustomMode == CMOVE_WallRunning;
+
+    // Never faster than the speed cap
+    if (HorizontalDistance > GlobalSpeedCap * Tolerance * DeltaTime)
+    {
+        return false;
+    }
+
+    // Anything above the fastest sustained speed comes out of the dash budget
+    const float RunSpeed = FMath::Max3(MaxWalkSpeed * (1.0f + MomentumSpeedMultiplier), WallRunSpeed, SlideSpeed);
+    const float DashBudget = ClientAuthDashBudget - FMath::Max(HorizontalDistance - RunSpeed * Tolerance * DeltaTime, 0.0f);
+    if (DashBudget < 0.0f)
+    {
+        return false;
+    }
+
+    // Rising no faster than the strongest jump and falling no faster than terminal velocity, plus a step
+    const float MaxRiseSpeed = FMath::Max3(JumpZVelocity, DoubleJumpZVelocity, WallRunJumpOffForce);
+    const float MaxFallSpeed = GetPhysicsVolume()->TerminalVelocity;
+    if (Delta.Z > MaxRiseSpeed * Tolerance * DeltaTime + MaxStepHeight || -Delta.Z > MaxFallSpeed * Tolerance * DeltaTime + MaxStepHeight)
+    {
+        return false;
+    }
+
+    // Wall runs last no longer than MaxWallRunTime
+    const float WallRunTime = bClientWallRunning ? ClientAuthWallRunTime + DeltaTime : 0.0f;
+    if (WallRunTime > MaxWallRunTime * Tolerance)
+    {
+        return false;
+    }
+
+    ClientAuthDashBudget = DashBudget;
+    ClientAuthWallRunTime = WallRunTime;
+    return true;
+}
+
+bool URMCMovementComponent::ApplyClientAuthoritativeMove(const FVector& ClientLocation, uint8 ClientMovementMode, float DeltaTime)
+{
+    // The envelope bounds how far the client went, not whether it went through a wall. Shrunk slightly so a
+    // capsule resting against the floor or a wall doesn't count as blocked.
+    FHitResult Hit;
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(RMCClientAuthMove), false, CharacterOwner);
+    FCollisionResponseParams ResponseParams;
+    InitCollisionParams(QueryParams, ResponseParams);
+    if (GetWorld()->SweepSingleByChannel(Hit, UpdatedComponent->GetComponentLocation(), ClientLocation, UpdatedComponent->GetComponentQuat(),
+        UpdatedComponent->GetCollisionObjectType(), GetPawnCapsuleCollisionShape(SHRINK_AllCustom, 2.0f), QueryParams, ResponseParams))
+    {
+        return false;
+    }
+
+    TEnumAsByte<EMovementMode> ClientMode;
+    TEnumAsByte<EMovementMode> ClientGroundMode;
+    uint8 ClientCustomMode = 0;
+    UnpackNetworkMovementMode(ClientMovementMode, ClientMode, ClientCustomMode, ClientGroundMode);
+
+    const bool bClientWallRunning = ClientMode == MOVE_Custom && ClientCustomMode == CMOVE_WallRunning;
+    const bool bClientSliding = ClientMode == MOVE_Custom && ClientCustomMode == CMOVE_Sliding;
+    const bool bClientDashing = ClientMode == MOVE_Custom && ClientCustomMode == CMOVE_Dashing;
+    const FVector ClientVelocity = (ClientLocation - UpdatedComponent->GetComponentLocation()) / DeltaTime;
+
+    // Leave the modes the client has left, then take its mode
+    if (bIsWallRunning && !bClientWallRunning)
+    {
+        EndWallRun();
+    }
+    if (bIsSliding && !bClientSliding)
+    {
+        EndSlide();
+    }
+    if (bIsDashing && !bClientDashing)
+    {
+        EndDash();
+    }
+
+    if (MovementMode != ClientMode || (ClientMode == MOVE_Custom && CustomMovementMode != ClientCustomMode))
+    {
+        SetMovementMode(ClientMode, ClientCustomMode);
+    }
+
+    // Enter the modes the client has entered. State and events only, since the client did the moving.
+    if (bClientWallRunning && !bIsWallRunning)
+    {
+        bIsWallRunning = true;
+        FindWallRunSurface(CurrentWallNormal);
+        BroadcastWallRunBegin(CurrentWallNormal);
+    }
+    if (bClientSliding && !bIsSliding)
+    {
+        bIsSliding = true;
+        UCapsuleComponent* Capsule = CharacterOwner->GetCapsuleComponent();
+        Capsule->SetCapsuleHalfHeight(Capsule->GetUnscaledCapsuleHalfHeight() * SlideCapsuleHeightScale);
+        BroadcastSlideBegin();
+    }
+    if (bClientDashing && !bIsDashing)
+    {
+        bIsDashing = true;
+        DashDirection = ClientVelocity.GetSafeNormal2D();
+        BroadcastDashBegin(DashDirection);
+    }
+
+    // Mode exits can move the capsule, so place it last. The sweep above already cleared the path.
+    UpdatedComponent->SetWorldLocation(ClientLocation, false, nullptr, ETeleportType::None);
+    Velocity = ClientVelocity;
+    PhysicsRotation(DeltaTime);
+    UpdateComponentVelocity();
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Rollback
+
+void URMCMovementComponent::CaptureSnapshot(FRMCMovementSnapshot& OutSnapshot) const
+{
+    if (UpdatedComponent)
+    {
+        OutSnapshot.Location = UpdatedComponent->GetComponentLocation();
+        OutSnapshot.Rotation = UpdatedComponent->GetComponentQuat();
+    }
+    OutSnapshot.Velocity = Velocity;
+
+    OutSnapshot.MovementMode = MovementMode;
+    OutSnapshot.CustomMovementMode = CustomMovementMode;
+
+    if (CharacterOwner)
+    {
+        OutSnapshot.CapsuleHalfHeight = CharacterOwner->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+        OutSnapshot.bPressedJump = CharacterOwner->bPressedJump;
+        OutSnapshot.JumpCurrentCount = CharacterOwner->JumpCurrentCount;
+        OutSnapshot.JumpKeyHoldTime = CharacterOwner->JumpKeyHoldTime;
+        OutSnapshot.JumpForceTimeRemaining = CharacterOwner->JumpForceTimeRemaining;
+    }
+
+    OutSnapshot.bIsWallRunning = bIsWallRunning;
+    OutSnapshot.bIsSliding = bIsSliding;
+    OutSnapshot.bIsDashing = bIsDashing;
+    OutSnapshot.bHasDoubleJumped = bHasDoubleJumped;
+    OutSnapshot.Momentum = CurrentMomentum;
+    OutSnapshot.WallNormal = CurrentWallNormal;
+    OutSnapshot.DashDirection = DashDirection;
+
+    OutSnapshot.Timers = MovementTimers;
+}
+
+void URMCMovementComponent::RestoreSnapshot(const FRMCMovementSnapshot& Snapshot)
+{
+    if (CharacterOwner)
+    {
+        // Capsule first, so the teleport below is checked against the right shape
+        CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(Snapshot.CapsuleHalfHeight, false);
+        CharacterOwner->bPressedJump = Snapshot.bPressedJump;
+        CharacterOwner->JumpCurrentCount = Snapshot.JumpCurrentCount;
+        CharacterOwner->JumpKeyHoldTime = Snapshot.JumpKeyHoldTime;
+        CharacterOwner->JumpForceTimeRemaining = Snapshot.JumpForceTimeRemaining;
+    }
+
+    if (UpdatedComponent)
+    {
+        UpdatedComponent->SetWorldLocationAndRotation(Snapshot.Location, Snapshot.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+    }
+    Velocity = Snapshot.Velocity;
+
+    // Assigned directly: SetMovementMode would run OnMovementModeChanged and end abilities the snapshot has active
+    MovementMode = static_cast<EMovementMode>(Snapshot.MovementMode);
+    CustomMovementMode = Snapshot.CustomMovementMode;
+
+    bIsWallRunning = Snapshot.bIsWallRunning;
+    bIsSliding = Snapshot.bIsSliding;
+    bIsDashing = Snapshot.bIsDashing;
+    bHasDoubleJumped = Snapshot.bHasDoubleJumped;
+    CurrentMomentum = Snapshot.Momentum;
+    CurrentWallNormal = Snapshot.WallNormal;
+    DashDirection = Snapshot.DashDirection;
+
+    MovementTimers = Snapshot.Timers;
+    DashCooldownRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::DashCooldown);
+    WallRunTimeRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::WallRun);
+    SlideTimeRemaining = MovementTimers.GetRemaining(ERMCMovementTimer::Slide);
+
+    // Floor and pending input belong to the frame being discarded
+    ConsumeInputVector();
+    if (UpdatedComponent && IsMovingOnGround())
+    {
+        FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, false);
+    }
+}
+
+void URMCMovementComponent::RollbackSimulateStep(const FVector& MoveInput, float DeltaTime)
+{
+    if (!CharacterOwner || !UpdatedComponent || DeltaTime <= 0.0f)
+    {
+        return;
+    }
+
+    const FRMCMovementParams Params = MakeMovementParams();
+
+    ApplyPreMovementRules(DeltaTime, Params);
+
+    // Same sequence as ControlledCharacterMove, minus the autonomous proxy path: every peer simulates every character
+    CharacterOwner->CheckJumpInput(DeltaTime);
+    Acceleration = ScaleInputAcceleration(ConstrainInputAcceleration(MoveInput));
+    AnalogInputModifier = ComputeAnalogInputModifier();
+    PerformMovement(DeltaTime);
+    CharacterOwner->ClearJumpInput(DeltaTime);
+
+    ApplyPostMovementRules(DeltaTime, Params);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Pooling
+
+void URMCMovementComponent::ResetMovementState()
+{
+    const bool bWasSuppressingEvents = bSuppressMovementEvents;
+    bSuppressMovementEvents = true;
+
+    // Cleared before the mode change so OnMovementModeChanged finds nothing to end
+    bIsWallRunning = false;
+    bIsSliding = false;
+    bIsDashing = false;
+    bHasDoubleJumped = false;
+    CurrentWallNormal = FVector::ZeroVector;
+    DashDirection = FVector::ZeroVector;
+
+    MovementTimers.Reset();
+    DashCooldownRemaining = 0.0f;
+    WallRunTimeRemaining = 0.0f;
+    SlideTimeRemaining = 0.0f;
+
+    if (CharacterOwner)
+    {
+        // From the class default, as a slide may have left the capsule lowered
+        const ACharacter* DefaultCharacter = CharacterOwner->GetClass()->GetDefaultObject<ACharacter>();
+        CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight(), false);
+        CharacterOwner->bPressedJump = false;
+        CharacterOwner->JumpCurrentCount = 0;
+        CharacterOwner->JumpKeyHoldTime = 0.0f;
+        CharacterOwner->JumpForceTimeRemaining = 0.0f;
+    }
+
+    StopMovementImmediately();
+    ClearAccumulatedForces();
+    ConsumeInputVector();
+    SetMovementMode(MOVE_None);
+
+    // Tuning, profiles and profile as the class default has them, then the profile applied as BeginPlay does
+    const URMCMovementComponent* Archetype = CastChecked<URMCMovementComponent>(GetArchetype());
+    PhysicsProfiles = Archetype->PhysicsProfiles;
+    ApplyPhysicsValues(Archetype->MakeCurrentPhysicsProfile());
+    CurrentProfileName = Archetype->CurrentProfileName;
+    PhysicsProfileIndex = 0;
+    MARK_PROPERTY_DIRTY_FROM_NAME(URMCMovementComponent, PhysicsProfileIndex, this);
+    if (CurrentProfileName != NAME_None)
+    {
+        SetMovementPhysicsProfile(CurrentProfileName);
+    }
+    bAwaitingClientPhysicsProfile = false;
+
+    CurrentMomentum = MaxMomentum * 0.5f;
+    LastBroadcastMomentum = -1.0f;
+    LastMomentumBroadcastTime = 0.0;
+
+    SetMovementLOD(ERMCMovementLOD::Full);
+
+    NetUpdateBoostEndTime = 0.0;
+    ProxyModeElapsedTime = 0.0f;
+    ClientAuthDashBudget = 0.0f;
+    ClientAuthWallRunTime = 0.0f;
+
+    MarkReplicatedStateDirty();
+
+    bSuppressMovementEvents = bWasSuppressingEvents;
+}
+
+/** Removes Blueprint listeners that aren't the owner or something it owns */
+template <typename DelegateType>
+static void RemoveListenersOutside(DelegateType& Delegate, const AActor* Owner)
+{
+    for (UObject* Listener : Delegate.GetAllObjects())
+    {
+        if (Listener != Owner && !Listener->IsIn(Owner))
+        {
+            Delegate.RemoveAll(Listener);
+        }
+    }
+}
+
+void URMCMovementComponent::RemoveExternalEventBindings()
+{
+    const AActor* Owner = GetOwner();
+    RemoveListenersOutside(OnWallRunBegin, Owner);
+    RemoveListenersOutside(OnWallRunEnd, Owner);
+    RemoveListenersOutside(OnSlideBegin, Owner);
+    RemoveListenersOutside(OnSlideEnd, Owner);
+    RemoveListenersOutside(OnDashBegin, Owner);
+    RemoveListenersOutside(OnDashEnd, Owner);
+    RemoveListenersOutside(OnMomentumChanged, Owner);
+    RemoveListenersOutside(OnPhysicsProfileChanged, Owner);
+
+    // Native bindings can't be told apart by owner; the owner binds its own again
+    OnWallRunBeginNative.Clear();
+    OnWallRunEndNative.Clear();
+    OnSlideBeginNative.Clear();
+    OnSlideEndNative.Clear();
+    OnDashBeginNative.Clear();
+    OnDashEndNative.Clear();
+    OnMomentumChangedNative.Clear();
+    OnPhysicsProfileChangedNative.Clear();
+    OnMovementTimerExpiredNative.Clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Event Dispatch
+
+void URMCMovementComponent::CacheScriptEventImplementations()
+{
+    const UClass* Class = GetClass();
+    bScriptWallRunBegin = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, OnWallRunBegin_BP));
+    bScriptWallRunEnd = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, OnWallRunEnd_BP));
+    bScriptSlideBegin = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, OnSlideBegin_BP));
+    bScriptSlideEnd = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, OnSlideEnd_BP));
+    bScriptDashBegin = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, OnDashBegin_BP));
+    bScriptDashEnd = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, OnDashEnd_BP));
+    bScriptDoubleJump = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, OnDoubleJump_BP));
+    bScriptPhysicsProfileChanged = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, OnPhysicsProfileChanged_BP));
+    bScriptAddMomentum = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, AddMomentum));
+    bScriptReduceMomentum = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(URMCMovementComponent, ReduceMomentum));
+}
+
+void URMCMovementComponent::BroadcastWallRunBegin(const FVector& WallNormal)
+{
+    if (bSuppressMovementEvents)
+    {
+        return;
+    }
+
+    OnWallRunBeginNative.Broadcast(WallNormal);
+    if (OnWallRunBegin.IsBound())
+    {
+        OnWallRunBegin.Broadcast(WallNormal);
+    }
+    if (bScriptWallRunBegin)
+    {
+        OnWallRunBegin_BP(WallNormal);
+    }
+}
+
+void URMCMovementComponent::BroadcastWallRunEnd()
+{
+    if (bSuppressMovementEvents)
+    {
+        return;
+    }
+
+    OnWallRunEndNative.Broadcast();
+    if (OnWallRunEnd.IsBound())
+    {
+        OnWallRunEnd.Broadcast();
+    }
+    if (bScriptWallRunEnd)
+    {
+        OnWallRunEnd_BP();
+    }
+}
+
+void URMCMovementComponent::BroadcastSlideBegin()
+{
+    if (bSuppressMovementEvents)
+    {
+        return;
+    }
+
+    OnSlideBeginNative.Broadcast();
+    if (OnSlideBegin.IsBound())
+    {
+        OnSlideBegin.Broadcast();
+    }
+    if (bScriptSlideBegin)
+    {
+        OnSlideBegin_BP();
+    }
+}
+
+void URMCMovementComponent::BroadcastSlideEnd()
+{
+    if (bSuppressMovementEvents)
+    {
+        return;
+    }
+
+    OnSlideEndNative.Broadcast();
+    if (OnSlideEnd.IsBound())
+    {
+        OnSlideEnd.Broadcast();
+    }
+    if (bScriptSlideEnd)
+    {
+        OnSlideEnd_BP();
+    }
+}
+
+void URMCMovementComponent::BroadcastDashBegin(const FVector& Direction)
+{
+    if (bSuppressMovementEvents)
+    {
+        return;
+    }
+
+    OnDashBeginNative.Broadcast(Direction);
+    if (OnDashBegin.IsBound())
+    {
+        OnDashBegin.Broadcast(Direction);
+    }
+    if (bScriptDashBegin)
+    {
+        OnDashBegin_BP(Direction);
+    }
+}
+
+void URMCMovementComponent::BroadcastDashEnd()
+{
+    if (bSuppressMovementEvents)
+    {
+        return;
+    }
+
+    OnDashEndNative.Broadcast();
+    if (OnDashEnd.IsBound())
+    {
+        OnDashEnd.Broadcast();
+    }
+    if (bScriptDashEnd)
+    {
+        OnDashEnd_BP();
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // IRMCMomentumBased Interface Implementation
 
@@ -1670,13 +3006,13 @@ float URMCMovementComponent::GetCurrentMomentum_Implementation() const
 void URMCMovementComponent::AddMomentum_Implementation(float Amount)
 {
     CurrentMomentum = FMath::Clamp(CurrentMomentum + Amount, 0.0f, MaxMomentum);
-    OnMomentumChanged.Broadcast(CurrentMomentum);
+    BroadcastMomentumChanged();
 }
 
 void URMCMovementComponent::ReduceMomentum_Implementation(float Amount)
 {
     CurrentMomentum = FMath::Clamp(CurrentMomentum - Amount, 0.0f, MaxMomentum);
-    OnMomentumChanged.Broadcast(CurrentMomentum);
+    BroadcastMomentumChanged();
 }
 
 bool URMCMovementComponent::HasMinimumMomentumForAction_Implementation(float RequiredMomentum) const
@@ -5,10 +5,17 @@
 #include "CoreMinimal.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "../../Interfaces/RMCMomentumBased.h"
+#include "RMCTrajectoryPrediction.h"
+#include "RMCMovementSimulation.h"
+#include "RMCMovementTimers.h"
+#include "RMCMovementSnapshot.h"
+#include "RMCCorrectionStats.h"
+#include "RMCNetworkMoveData.h"
 #include "RMCMovementComponent.generated.h"
 
 // Forward declarations
 class ACharacter;
+struct FRMCMovementBookkeepingBatch;
 
 // Delegates
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWallRunBegin, const FVector&, WallNormal);
@@ -20,6 +27,33 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDashEnd);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMomentumChanged, float, NewMomentum);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPhysicsProfileChanged, FName, ProfileName);
 
+// Native delegates for C++ listeners, broadcast without going through reflection
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnWallRunBeginNative, const FVector& /*WallNormal*/);
+DECLARE_MULTICAST_DELEGATE(FOnWallRunEndNative);
+DECLARE_MULTICAST_DELEGATE(FOnSlideBeginNative);
+DECLARE_MULTICAST_DELEGATE(FOnSlideEndNative);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDashBeginNative, const FVector& /*DashDirection*/);
+DECLARE_MULTICAST_DELEGATE(FOnDashEndNative);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMomentumChangedNative, float /*NewMomentum*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPhysicsProfileChangedNative, FName /*ProfileName*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMovementTimerExpiredNative, uint8 /*TimerId*/);
+
+/**
+ * Movement fidelity tiers, picked by URMCSignificanceSubsystem from distance to the nearest viewer
+ */
+UENUM(BlueprintType)
+enum class ERMCMovementLOD : uint8
+{
+    // Every tick, every wall probe, cosmetics
+    Full,
+    // Lower tick rate, fewer wall probes reused for a short while, no cosmetics
+    Reduced,
+    // Low tick rate, and no new wall runs
+    Minimal,
+    // Not ticking at all
+    Dormant
+};
+
 /**
  * Physics profile for movement component
  */
@@ -280,7 +314,7 @@ public:
         ToolTip = "How much momentum affects acceleration (higher = more effect)"))
     float MomentumAccelerationMultiplier;
 
-    // Physics Profiles
+    // Physics Profiles. Switches travel over the network by index, so the list must match on server and clients.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Physics Profiles",
         meta = (ToolTip = "Collection of physics profiles that can be applied to the movement component"))
     TArray<FMovementPhysicsProfile> PhysicsProfiles;
@@ -289,14 +323,19 @@ public:
         meta = (ToolTip = "Currently active physics profile name"))
     FName CurrentProfileName;
 
-    // Movement states
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|States")
+    // Checked on the server against the profile each client move carries
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Physics Profiles",
+        meta = (ToolTip = "Profiles the owning client may switch to on its own. Any other switch has to come from the server."))
+    TArray<FName> ClientSelectablePhysicsProfiles;
+
+    // Movement states. The mode flags replicate to simulated proxies for animation.
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Replicated, Category = "Movement|States")
     bool bIsWallRunning;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|States")
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_IsSliding, Category = "Movement|States")
     bool bIsSliding;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|States")
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Replicated, Category = "Movement|States")
     bool bIsDashing;
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|States")
@@ -305,6 +344,7 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|States")
     float CurrentMomentum;
 
+    // Read-only mirrors of the movement timers, refreshed every tick
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|States")
     float DashCooldownRemaining;
 
@@ -320,6 +360,94 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement|States")
     FVector DashDirection;
 
+    // Batched bookkeeping
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Performance",
+        meta = (ToolTip = "Skip per-component momentum, speed cap and timer updates; URMCMovementSubsystem does them for all characters in one pass"))
+    bool bUseBatchedBookkeeping;
+
+    // Movement LOD
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Performance",
+        meta = (ClampMin = "0.0", ToolTip = "Tick interval at Reduced movement LOD"))
+    float ReducedLODTickInterval;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Performance",
+        meta = (ClampMin = "0.0", ToolTip = "Tick interval at Minimal movement LOD"))
+    float MinimalLODTickInterval;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Performance",
+        meta = (ClampMin = "1", ClampMax = "8", ToolTip = "Wall probe directions below Full movement LOD, likeliest first"))
+    int32 ReducedLODWallProbeDirections;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Performance",
+        meta = (ClampMin = "0.0", ToolTip = "How long a wall probe result is reused below Full movement LOD"))
+    float ReducedLODWallProbeCacheSeconds;
+
+    // Network update rate
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ToolTip = "On the server, drive the owner's NetUpdateFrequency from movement state and speed"))
+    bool bAdaptiveNetUpdateFrequency;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ClampMin = "1.0", UIMin = "1.0", UIMax = "30.0",
+        ToolTip = "Updates per second while standing still on the ground"))
+    float IdleNetUpdateFrequency;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ClampMin = "1.0", UIMin = "10.0", UIMax = "120.0",
+        ToolTip = "Updates per second while wall running, sliding or dashing, just after a mode change, and at HighSpeedNetUpdateThreshold"))
+    float MaxNetUpdateFrequency;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ClampMin = "0.0", UIMin = "500.0", UIMax = "3000.0",
+        ToolTip = "Speed at which the update rate reaches MaxNetUpdateFrequency; slower movement scales between the idle and maximum rates"))
+    float HighSpeedNetUpdateThreshold;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "2.0",
+        ToolTip = "Seconds the update rate stays at its maximum after a movement mode change"))
+    float NetUpdateBoostDuration;
+
+    // Simulated proxies
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ToolTip = "Extrapolate other players' wall runs, slides and dashes with the RMC mode rules instead of constant velocity"))
+    bool bModeAwareProxySimulation;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "0.5",
+        ToolTip = "Seconds a simulated proxy takes to smooth out a correction while wall running"))
+    float WallRunProxySmoothLocationTime;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "0.5",
+        ToolTip = "Seconds a simulated proxy takes to smooth out a correction while sliding"))
+    float SlideProxySmoothLocationTime;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "0.5",
+        ToolTip = "Seconds a simulated proxy takes to smooth out a correction while dashing. Keep well under DashDuration."))
+    float DashProxySmoothLocationTime;
+
+    // Client-authoritative movement
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ToolTip = "On the server, take the owning client's position when the move fits the movement envelope instead of simulating it. Moves outside the envelope are simulated and corrected as usual. Meant for co-op sessions."))
+    bool bClientAuthoritativeMovement;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Network",
+        meta = (ClampMin = "1.0", UIMin = "1.0", UIMax = "2.0",
+        ToolTip = "Slack applied to every envelope bound, for timestamp jitter and quantized client positions"))
+    float ClientAuthEnvelopeTolerance;
+
+    /** Client moves taken without simulating them since BeginPlay */
+    int32 GetClientAuthMovesAccepted() const { return ClientAuthMovesAccepted; }
+
+    /** Client moves that fell outside the envelope and were simulated since BeginPlay */
+    int32 GetClientAuthMovesRejected() const { return ClientAuthMovesRejected; }
+
+    /** On the server, error and corrections of this character's client moves by mode */
+    const FRMCCorrectionStats& GetCorrectionStats() const { return CorrectionStats; }
+
+    void ResetCorrectionStats() { CorrectionStats.Reset(); }
+
     // Blueprint events
     UPROPERTY(BlueprintAssignable, Category = "Movement|Events")
     FOnWallRunBegin OnWallRunBegin;
@@ -345,6 +473,28 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Movement|Events")
     FOnPhysicsProfileChanged OnPhysicsProfileChanged;
 
+    // Native events, broadcast before the Blueprint-assignable ones. Prefer these from C++.
+    FOnWallRunBeginNative OnWallRunBeginNative;
+    FOnWallRunEndNative OnWallRunEndNative;
+    FOnSlideBeginNative OnSlideBeginNative;
+    FOnSlideEndNative OnSlideEndNative;
+    FOnDashBeginNative OnDashBeginNative;
+    FOnDashEndNative OnDashEndNative;
+    FOnMomentumChangedNative OnMomentumChangedNative;
+    FOnPhysicsProfileChangedNative OnPhysicsProfileChangedNative;
+    FOnMovementTimerExpiredNative OnMovementTimerExpiredNative;
+
+    // Momentum notification throttling
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Events",
+        meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "10.0",
+        ToolTip = "Momentum must move at least this far from the last notified value before OnMomentumChanged fires again. Reaching 0 or MaxMomentum always notifies."))
+    float MomentumBroadcastQuantum;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Events",
+        meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "1.0",
+        ToolTip = "Minimum seconds between OnMomentumChanged notifications. Reaching 0 or MaxMomentum always notifies."))
+    float MomentumBroadcastMinInterval;
+
     // Blueprint callable functions for movement
     UFUNCTION(BlueprintCallable, Category = "Movement|Wall Running")
     void StartWallRun();
@@ -385,9 +535,100 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Movement|Momentum")
     void UpdateMomentum(float DeltaTime);
 
+    /** Notifies momentum listeners, subject to MomentumBroadcastQuantum and MomentumBroadcastMinInterval unless forced */
+    void BroadcastMomentumChanged(bool bForce = false);
+
+    // Movement timers
+    /** Starts or restarts a movement timer. Ids from ERMCMovementTimer::FirstCustom are free for new abilities. */
+    void SetMovementTimer(uint8 TimerId, float Duration);
+
+    void ClearMovementTimer(uint8 TimerId);
+
+    float GetMovementTimerRemaining(uint8 TimerId) const;
+
+    /** Cooldowns and durations, keyed on simulation time */
+    const FRMCMovementTimerWheel& GetMovementTimers() const { return MovementTimers; }
+
+    // Rollback
+    /** Copies everything a rollback needs to return to this frame */
+    void CaptureSnapshot(FRMCMovementSnapshot& OutSnapshot) const;
+
+    /** Returns to a captured frame without firing movement events or mode change callbacks */
+    void RestoreSnapshot(const FRMCMovementSnapshot& Snapshot);
+
+    /**
+     * Runs one step of movement with the given world-space input, for characters whose component tick is
+     * disabled and whose simulation is driven from outside, such as by the rollback subsystem
+     */
+    void RollbackSimulateStep(const FVector& MoveInput, float DeltaTime);
+
+    /** Holds back movement events, used while resimulating frames whose events already fired */
+    void SetMovementEventsSuppressed(bool bSuppressed) { bSuppressMovementEvents = bSuppressed; }
+
+    // Pooling
+    /**
+     * Returns movement to how the class default starts play: no ability active, timers cleared, capsule
+     * at full height, at rest with starting momentum, on the default profile and at Full LOD. Fires no events.
+     */
+    void ResetMovementState();
+
+    /** Unbinds every native listener, and Blueprint listeners other than the owner and its components */
+    void RemoveExternalEventBindings();
+
     // Non-interface version of GetMomentumPercent
     UFUNCTION(BlueprintCallable, Category = "Movement|Momentum")
     float GetMomentumPercentage() const;
+
+    /** Current mode as the predictor, rewind buffer and correction stats see it */
+    ERMCPredictedMovementMode GetPredictedMovementMode() const;
+
+    /** The same for a mode packed by PackNetworkMovementMode, as sent in move messages */
+    ERMCPredictedMovementMode GetPredictedMovementModeFromNetwork(uint8 NetworkMovementMode) const;
+
+    // Trajectory prediction
+    /** Builds the snapshot the closed-form predictor works from */
+    FRMCTrajectoryState MakeTrajectoryState() const;
+
+    /** Predicts SampleCount points over the next Seconds without allocating. Returns the number of samples written. */
+    int32 PredictTrajectory(float Seconds, int32 SampleCount, TArrayView<FRMCTrajectorySample> OutSamples, bool bAssumeDoubleJump = false) const;
+
+    /** Predicts many characters at once. OutSamples is row-major and needs Components.Num() * SampleCount entries. */
+    static int32 PredictTrajectories(TArrayView<const URMCMovementComponent* const> Components, float Seconds, int32 SampleCount,
+        TArrayView<FRMCTrajectorySample> OutSamples, bool bAssumeDoubleJump = false);
+
+    UFUNCTION(BlueprintCallable, Category = "Movement|Prediction",
+        meta = (ToolTip = "Predicts where the character will be over the next Seconds, evaluated analytically per movement mode"))
+    void GetPredictedTrajectory(float Seconds, int32 SampleCount, bool bAssumeDoubleJump, TArray<FRMCTrajectorySample>& OutSamples) const;
+
+    UFUNCTION(BlueprintPure, Category = "Movement|Prediction",
+        meta = (ToolTip = "Predicted location of the character Seconds from now"))
+    FVector PredictLocationAtTime(float Seconds, bool bAssumeDoubleJump = false) const;
+
+    // Batched bookkeeping
+    /**
+     * Runs momentum and the speed cap for every component in one vectorized pass and writes the results
+     * back, then advances each component's movement timers, then fires momentum events. URMCMovementSubsystem
+     * calls this once per frame after movement has ticked. Components for which IsBookkeepingBatched is false,
+     * including ones not ticking (dormant or stepped by rollback), and replicated proxies are skipped.
+     */
+    static void UpdateBookkeepingBatched(TArrayView<URMCMovementComponent* const> Components, float DeltaTime, FRMCMovementBookkeepingBatch& Scratch);
+
+    /**
+     * Whether the batched pass does this component's momentum, speed cap and timers instead of its own tick.
+     * Only when bUseBatchedBookkeeping is set, a URMCMovementSubsystem has the component registered and
+     * the component ticks, so the flag never switches the per-component path off without something taking
+     * its place. Rollback steps characters with their tick off, so they keep the per-component path. So do
+     * components with Blueprint momentum overrides, a reduced LOD tick interval or debug output on.
+     */
+    bool IsBookkeepingBatched() const;
+
+    /** Applies a movement LOD tier's tick rate and probe budget. Dormant stops the component ticking. */
+    void SetMovementLOD(ERMCMovementLOD NewLOD);
+
+    ERMCMovementLOD GetMovementLOD() const { return MovementLOD; }
+
+    /** Seconds every RMC movement component together spent ticking and processing client moves since the last call */
+    static double ConsumeMovementSeconds();
     
     // Debug helper functions
     UFUNCTION(BlueprintCallable, Category = "Movement|Debug")
@@ -431,6 +672,18 @@ public:
         meta = (ToolTip = "Returns all available physics profile names"))
     TArray<FName> GetAvailablePhysicsProfileNames() const;
 
+    /** The current tuning values as a profile named after the current one */
+    FMovementPhysicsProfile MakeCurrentPhysicsProfile() const;
+
+    /** Profile with the given name in PhysicsProfiles, or null */
+    const FMovementPhysicsProfile* FindPhysicsProfile(FName ProfileName) const;
+
+    /** Active profile as 1 + its index in PhysicsProfiles, or 0 before one is applied. This is what moves and proxies carry. */
+    uint8 GetPhysicsProfileIndex() const { return PhysicsProfileIndex; }
+
+    /** Applies a profile by its network index without telling the server or clients; used by move prediction and replication */
+    void ApplyPhysicsProfileIndex(uint8 Index);
+
     // Speed cap settings
 UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Physics|Speed Cap", 
     meta = (ClampMin = "0.0", UIMin = "1000.0", UIMax = "5000.0", 
@@ -513,15 +766,23 @@ bool bApplySpeedCapToZVelocity;
 
     // Override movement functions
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
     virtual float GetMaxSpeed() const override;
     virtual float GetMaxAcceleration() const override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+    virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+    virtual bool ClientUpdatePositionAfterServerUpdate() override;
 
 protected:
     virtual void PhysWalking(float deltaTime, int32 Iterations) override;
     virtual void PhysCustom(float deltaTime, int32 Iterations) override;
     virtual bool DoJump(bool bReplayingMoves) override;
+    virtual void MoveSmooth(const FVector& InVelocity, const float DeltaSeconds, FStepDownResult* OutStepDownResult = nullptr) override;
+    virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel) override;
+    virtual bool ServerCheckClientError(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FVector& ClientWorldLocation,
+        const FVector& RelativeClientLocation, UPrimitiveComponent* ClientMovementBase, FName ClientBaseBoneName, uint8 ClientMovementMode) override;
 
     // Custom movement modes
     enum ECustomMovementMode
@@ -544,24 +805,208 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "Movement|Utility")
     void ApplyDashForces(float DeltaTime);
 
-    UFUNCTION(BlueprintCallable, Category = "Movement|Utility")
+    /** Ends a dash once its duration runs out, applying the exit boost */
+    void EndDash();
+
+    // Movement timers advance on their own every tick. These only take extra time off one, as calling them used to.
+    UFUNCTION(BlueprintCallable, Category = "Movement|Utility",
+        meta = (DeprecatedFunction, DeprecationMessage = "The dash cooldown counts down on its own. Read DashCooldownRemaining instead."))
     void UpdateDashCooldown(float DeltaTime);
 
-    UFUNCTION(BlueprintCallable, Category = "Movement|Utility")
+    UFUNCTION(BlueprintCallable, Category = "Movement|Utility",
+        meta = (DeprecatedFunction, DeprecationMessage = "Wall run time counts down on its own. Read WallRunTimeRemaining instead."))
     void UpdateWallRunTime(float DeltaTime);
 
-    UFUNCTION(BlueprintCallable, Category = "Movement|Utility")
+    UFUNCTION(BlueprintCallable, Category = "Movement|Utility",
+        meta = (DeprecatedFunction, DeprecationMessage = "Slide time counts down on its own. Read SlideTimeRemaining instead."))
     void UpdateSlideTime(float DeltaTime);
 
     UFUNCTION(BlueprintCallable, Category = "Movement|Utility")
     void ResetJumpState();
 
+    /** Copies the current tuning values into the engine-independent simulation parameters */
+    FRMCMovementParams MakeMovementParams() const;
+
     // Default physics profile
     void InitializeDefaultPhysicsProfile();
     FMovementPhysicsProfile DefaultPhysicsProfile;
 
-    // Timer handles
-    FTimerHandle TimerHandle_WallRunTimeout;
-    FTimerHandle TimerHandle_SlideTimeout;
-    FTimerHandle TimerHandle_DashTimeout;
+    /** Copies a profile's values into the tuning properties, without touching the current profile name or index */
+    void ApplyPhysicsValues(const FMovementPhysicsProfile& Profile);
+
+    /** Speed cap, applied before the engine moves the character */
+    void ApplyPreMovementRules(float DeltaTime, const FRMCMovementParams& Params);
+
+    /** Momentum, timers and mode exits, applied after the engine has moved the character */
+    void ApplyPostMovementRules(float DeltaTime, const FRMCMovementParams& Params);
+
+    // Movement timers
+    /** Advances the timer wheel by one step of simulation time and refreshes the countdown properties */
+    void AdvanceMovementTimers(float DeltaTime);
+
+    /** Handles an expired timer. Override to react to custom ability timers. */
+    virtual void OnMovementTimerExpired(uint8 TimerId);
+
+    /** Brings a running timer DeltaTime closer to expiring, firing it if that runs it out */
+    void ShortenMovementTimer(ERMCMovementTimer Timer, float DeltaTime);
+
+    // Dash cooldown, dash, wall run and slide timers plus any added by abilities
+    FRMCMovementTimerWheel MovementTimers;
+
+    // Event dispatch
+    /** Records which Blueprint events the owning class implements so unimplemented ones are never dispatched */
+    void CacheScriptEventImplementations();
+
+    void BroadcastWallRunBegin(const FVector& WallNormal);
+    void BroadcastWallRunEnd();
+    void BroadcastSlideBegin();
+    void BroadcastSlideEnd();
+    void BroadcastDashBegin(const FVector& Direction);
+    void BroadcastDashEnd();
+
+    // Blueprint events implemented by this class, cached at BeginPlay
+    uint8 bScriptWallRunBegin : 1;
+    uint8 bScriptWallRunEnd : 1;
+    uint8 bScriptSlideBegin : 1;
+    uint8 bScriptSlideEnd : 1;
+    uint8 bScriptDashBegin : 1;
+    uint8 bScriptDashEnd : 1;
+    uint8 bScriptDoubleJump : 1;
+    uint8 bScriptPhysicsProfileChanged : 1;
+    uint8 bScriptAddMomentum : 1;
+    uint8 bScriptReduceMomentum : 1;
+
+    // Set while resimulating
+    uint8 bSuppressMovementEvents : 1;
+
+    // Set while a URMCMovementSubsystem has this component registered for the batched pass
+    uint8 bRegisteredForBatchedBookkeeping : 1;
+
+    // Replication
+    /** On the server, marks the push-model properties whose values changed since the last call */
+    void MarkReplicatedStateDirty();
+
+    UFUNCTION()
+    void OnRep_ReplicatedMomentum();
+
+    // Momentum as a fraction of MaxMomentum in 1/255 steps, so small changes don't dirty it
+    UPROPERTY(ReplicatedUsing = OnRep_ReplicatedMomentum)
+    uint8 ReplicatedMomentum;
+
+    UFUNCTION()
+    void OnRep_IsSliding();
+
+    UFUNCTION()
+    void OnRep_ReplicatedWallNormal();
+
+    UFUNCTION()
+    void OnRep_ReplicatedDashDirection();
+
+    // Wall normal and dash direction as a yaw in 1/256 turns. Both are horizontal, and a byte each keeps
+    // proxies and replay checkpoints small; they only change when a wall run or dash starts.
+    UPROPERTY(ReplicatedUsing = OnRep_ReplicatedWallNormal)
+    uint8 ReplicatedWallNormalYaw;
+
+    UPROPERTY(ReplicatedUsing = OnRep_ReplicatedDashDirection)
+    uint8 ReplicatedDashYaw;
+
+    /** Simulated proxy following the server's movement, as opposed to one every peer simulates under rollback */
+    bool IsReplicatedProxy() const;
+
+    UFUNCTION()
+    void OnRep_PhysicsProfileIndex();
+
+    // See GetPhysicsProfileIndex. Owners predict their own; proxies and replays get this instead of the profile's values.
+    UPROPERTY(ReplicatedUsing = OnRep_PhysicsProfileIndex)
+    uint8 PhysicsProfileIndex;
+
+    /** Sent when the server switches a remotely controlled character's profile, so the client's moves pick it up */
+    UFUNCTION(Client, Reliable)
+    void ClientSetPhysicsProfileIndex(uint8 Index);
+
+    /**
+     * On the server, switches to the profile a client move was made with, before simulating it. A profile
+     * outside ClientSelectablePhysicsProfiles is ignored and the client is sent back to the server's.
+     */
+    void ApplyClientMovePhysicsProfile(uint8 Index);
+
+    // Set on the server after it switches or restores a remote client's profile, until that client's moves carry it
+    uint8 bAwaitingClientPhysicsProfile : 1;
+
+    // Movement LOD
+    /** The wall probe itself, trying at most MaxDirections directions */
+    bool ProbeWallRunSurface(FVector& OutWallNormal, int32 MaxDirections) const;
+
+    ERMCMovementLOD MovementLOD;
+
+    // Last wall probe below Full LOD, reused for ReducedLODWallProbeCacheSeconds
+    mutable double LastWallProbeTime;
+    mutable FVector LastWallProbeNormal;
+    mutable bool bLastWallProbeHit;
+
+    /** On a simulated proxy, sizes the capsule for the replicated slide state without moving the actor */
+    void ApplyProxySlideCapsule();
+
+    /** On the server, raises the update rate for a while and sends an update now */
+    void BoostNetUpdateFrequency();
+
+    /** On the server, picks the owner's NetUpdateFrequency for the current movement state and speed */
+    void UpdateNetUpdateFrequency();
+
+    // World time until which a recent mode change keeps the update rate at its maximum
+    double NetUpdateBoostEndTime;
+
+    // Simulated proxies
+    /** Predictor input for a simulated proxy, built from the replicated mode and velocity and the time spent in the mode */
+    FRMCTrajectoryState MakeProxyTrajectoryState() const;
+
+    /** Picks the correction smoothing time for the proxy's current mode */
+    void UpdateProxySmoothing();
+
+    // Seconds a simulated proxy has spent in its current mode
+    float ProxyModeElapsedTime;
+
+    // NetworkSimulatedSmoothLocationTime as configured, used outside RMC modes
+    float DefaultProxySmoothLocationTime;
+
+    // Client-authoritative movement
+    /**
+     * Constant-time plausibility check of a client move against the active profile: the speed cap, a dash
+     * budget refilled at DashDistance per DashCooldown, jump velocities and the wall run time limit.
+     */
+    bool IsWithinMovementEnvelope(const FVector& ClientLocation, uint8 ClientMovementMode, float DeltaTime);
+
+    /**
+     * Takes a client move that passed the envelope as the server's state, without simulating it. Returns
+     * false, changing nothing, if the capsule can't sweep there from the server's position.
+     */
+    bool ApplyClientAuthoritativeMove(const FVector& ClientLocation, uint8 ClientMovementMode, float DeltaTime);
+
+    // Extra horizontal distance the client may cover above its running speed, refilled by the dash cooldown
+    float ClientAuthDashBudget;
+
+    // Seconds the client has reported wall running without a break
+    float ClientAuthWallRunTime;
+
+    int32 ClientAuthMovesAccepted;
+    int32 ClientAuthMovesRejected;
+
+    // Set when the last move passed the envelope, so it isn't checked for a correction
+    uint8 bLastMoveClientAuthoritative : 1;
+
+    // Filled in by ServerCheckClientError
+    FRMCCorrectionStats CorrectionStats;
+
+    // Move message containers, registered with the engine in the constructor
+    FRMCNetworkMoveDataContainer RMCNetworkMoveDataContainer;
+    FRMCMoveResponseDataContainer RMCMoveResponseDataContainer;
+
+    // Mode flags as of the last MarkReplicatedStateDirty
+    uint8 bLastReplicatedWallRunning : 1;
+    uint8 bLastReplicatedSliding : 1;
+    uint8 bLastReplicatedDashing : 1;
+
+    // Last momentum value listeners were told about
+    float LastBroadcastMomentum;
+    double LastMomentumBroadcastTime;
 };
\ No newline at end of file
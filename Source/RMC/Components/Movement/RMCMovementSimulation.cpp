@@ -0,0 +1,221 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMovementSimulation.h"
+
+FVector FRMCMovementSimulation::ApplyWallRunForces(const FRMCMovementParams& Params, const FVector& Velocity, const FVector& WallNormal,
+    const FVector& MoveInput, float DeltaTime)
+{
+    // Calculate wall run direction (along the wall)
+    FVector WallRunDirection = FVector::CrossProduct(WallNormal, FVector(0, 0, 1)).GetSafeNormal();
+
+    // Make sure we're running in the correct direction along the wall
+    if (FVector::DotProduct(WallRunDirection, Velocity) < 0)
+    {
+        WallRunDirection = -WallRunDirection;
+    }
+
+    // Apply reduced gravity using the configurable gravity scale
+    const FVector Gravity = FVector(0, 0, Params.GravityZ * Params.WallRunGravityScale * DeltaTime);
+
+    // Apply wall attraction force to keep character on the wall
+    const FVector WallAttractionVector = -WallNormal * Params.WallAttractionForce * DeltaTime;
+
+    // If player is pressing forward, give a speed boost
+    const float ForwardInput = FVector::DotProduct(MoveInput, WallRunDirection);
+    const float SpeedMultiplier = (ForwardInput > 0.1f) ? 1.2f : 1.0f;
+
+    // Set base velocity along the wall, then apply gravity and wall attraction
+    FVector NewVelocity = WallRunDirection * Params.WallRunSpeed * SpeedMultiplier;
+    NewVelocity += Gravity;
+    NewVelocity += WallAttractionVector;
+
+    // Allow some control for the player (only along the wall)
+    if (!MoveInput.IsNearlyZero())
+    {
+        const FVector InputAlongWall = FVector::VectorPlaneProject(MoveInput, WallNormal);
+        NewVelocity += InputAlongWall * Params.WallRunControlMultiplier * 800.0f * DeltaTime;
+    }
+
+    // Ensure minimum velocity along wall to prevent sticking
+    if (NewVelocity.Size2D() < Params.WallRunSpeed * 0.7f)
+    {
+        NewVelocity = WallRunDirection * Params.WallRunSpeed * 0.7f;
+        NewVelocity += Gravity;
+        NewVelocity += WallAttractionVector;
+    }
+
+    return NewVelocity;
+}
+
+FVector FRMCMovementSimulation::ApplySlideForces(const FRMCMovementParams& Params, const FVector& Velocity, const FVector& FloorNormal,
+    const FVector& MoveInput, float DeltaTime)
+{
+    // Apply friction to slow down over time
+    FVector SlideDirection = Velocity.GetSafeNormal2D();
+    const float CurrentSpeed = Velocity.Size2D();
+    float NewSpeed = FMath::Max(CurrentSpeed - (Params.SlideFriction * CurrentSpeed * DeltaTime), Params.SlideMinSpeed);
+
+    // Apply gravity component along slope
+    const float FloorDot = FVector::DotProduct(FloorNormal, FVector(0, 0, 1));
+    const FVector SlopeGravityDirection = FVector(0, 0, -1) - FloorNormal * FloorDot;
+
+    // If on a slope, accelerate downhill
+    if (FloorDot < 0.9999f) // Not completely flat
+    {
+        const FVector DownhillDirection = SlopeGravityDirection.GetSafeNormal();
+        const float DownhillComponent = FVector::DotProduct(SlideDirection, DownhillDirection);
+
+        if (DownhillComponent > 0)
+        {
+            NewSpeed += 500.0f * DownhillComponent * Params.SlideDownhillAccelerationMultiplier * DeltaTime;
+        }
+    }
+
+    // Allow some steering from input
+    SlideDirection = FMath::VInterpTo(
+        SlideDirection,
+        (SlideDirection + MoveInput * 0.5f).GetSafeNormal(),
+        DeltaTime,
+        2.0f
+    );
+
+    // Cap at the configurable slide speed
+    return SlideDirection * FMath::Min(NewSpeed, Params.SlideSpeed);
+}
+
+FVector FRMCMovementSimulation::ApplyDashForces(const FRMCMovementParams& Params, const FVector& DashDirection)
+{
+    // During dash, maintain constant velocity in dash direction
+    const float DashSpeed = (Params.DashDuration > 0.0f) ? Params.DashDistance / Params.DashDuration : 0.0f;
+    return DashDirection * DashSpeed;
+}
+
+float FRMCMovementSimulation::ComputeMomentumDelta(const FRMCMovementParams& Params, const FVector& Velocity, float DeltaTime)
+{
+    const float SpeedSquared = Velocity.SizeSquared();
+
+    // Build momentum when moving at high speeds
+    if (SpeedSquared > FMath::Square(Params.MaxWalkSpeed * 1.2f))
+    {
+        return Params.MomentumBuildRate * DeltaTime;
+    }
+
+    // Decay momentum when moving slowly or not moving
+    if (SpeedSquared < FMath::Square(Params.MaxWalkSpeed * 0.5f))
+    {
+        return -Params.MomentumDecayRate * DeltaTime;
+    }
+
+    return 0.0f;
+}
+
+float FRMCMovementSimulation::ApplyMomentumDelta(const FRMCMovementParams& Params, float Momentum, float Delta)
+{
+    return FMath::Clamp(Momentum + Delta, 0.0f, Params.MaxMomentum);
+}
+
+bool FRMCMovementSimulation::ApplySpeedCap(const FRMCMovementParams& Params, FVector& InOutVelocity, float& OutPreviousSpeed, float& OutNewSpeed)
+{
+    if (Params.GlobalSpeedCap <= 0.0f)
+    {
+        return false;
+    }
+
+    // Cap either the full 3D velocity or only the horizontal part
+    const float CurrentSpeed = Params.bApplySpeedCapToZVelocity ? InOutVelocity.Size() : InOutVelocity.Size2D();
+    if (CurrentSpeed <= Params.GlobalSpeedCap)
+    {
+        return false;
+    }
+
+    // Calculate new speed with damping
+    const float NewSpeed = FMath::Lerp(CurrentSpeed, Params.GlobalSpeedCap, 1.0f - Params.SpeedCapDamping);
+
+    if (Params.bApplySpeedCapToZVelocity)
+    {
+        InOutVelocity = InOutVelocity.GetSafeNormal() * NewSpeed;
+    }
+    else
+    {
+        // Z velocity is unchanged
+        const FVector NewHorizontalVelocity = FVector(InOutVelocity.X, InOutVelocity.Y, 0.0f).GetSafeNormal() * NewSpeed;
+        InOutVelocity.X = NewHorizontalVelocity.X;
+        InOutVelocity.Y = NewHorizontalVelocity.Y;
+    }
+
+    OutPreviousSpeed = CurrentSpeed;
+    OutNewSpeed = NewSpeed;
+    return true;
+}
+
+bool FRMCMovementSimulation::ShouldEndWallRun(const FVector& Velocity, bool bFoundWall)
+{
+    return !bFoundWall || Velocity.SizeSquared() < 100.0f;
+}
+
+bool FRMCMovementSimulation::ShouldEndSlide(const FRMCMovementParams& Params, const FVector& Velocity, bool bOnGround)
+{
+    return Velocity.SizeSquared() < FMath::Square(Params.SlideMinSpeed) || !bOnGround;
+}
+
+FRMCMovementSimState FRMCMovementSimulation::Step(const FRMCMovementSimState& State, const FRMCMovementSimInput& Input,
+    const FRMCMovementParams& Params, const IRMCMovementSceneQuery& Scene, int32 AgentIndex)
+{
+    FRMCMovementSimState Result = State;
+    const float DeltaTime = Input.DeltaTime;
+
+    float PreviousSpeed = 0.0f;
+    float CappedSpeed = 0.0f;
+    ApplySpeedCap(Params, Result.Velocity, PreviousSpeed, CappedSpeed);
+
+    switch (Result.Mode)
+    {
+    case ERMCMovementSimMode::WallRunning:
+        Result.Velocity = ApplyWallRunForces(Params, Result.Velocity, Result.WallNormal, Input.MoveInput, DeltaTime);
+        break;
+
+    case ERMCMovementSimMode::Sliding:
+        Result.Velocity = ApplySlideForces(Params, Result.Velocity, Scene.GetFloorNormal(AgentIndex, Result), Input.MoveInput, DeltaTime);
+        break;
+
+    case ERMCMovementSimMode::Dashing:
+        Result.Velocity = ApplyDashForces(Params, Result.DashDirection);
+        break;
+
+    default:
+        break;
+    }
+
+    Result.Momentum = ApplyMomentumDelta(Params, Result.Momentum, ComputeMomentumDelta(Params, Result.Velocity, DeltaTime));
+
+    if (Result.Mode == ERMCMovementSimMode::WallRunning)
+    {
+        FVector WallNormal;
+        if (ShouldEndWallRun(Result.Velocity, Scene.FindWall(AgentIndex, Result, WallNormal)))
+        {
+            Result.Mode = ERMCMovementSimMode::Falling;
+            Result.WallNormal = FVector::ZeroVector;
+        }
+    }
+    else if (Result.Mode == ERMCMovementSimMode::Sliding)
+    {
+        const bool bOnGround = Scene.IsMovingOnGround(AgentIndex, Result);
+        if (ShouldEndSlide(Params, Result.Velocity, bOnGround))
+        {
+            Result.Mode = bOnGround ? ERMCMovementSimMode::Walking : ERMCMovementSimMode::Falling;
+        }
+    }
+
+    return Result;
+}
+
+void FRMCMovementSimulation::StepBatch(TArrayView<FRMCMovementSimState> States, TArrayView<const FRMCMovementSimInput> Inputs,
+    const FRMCMovementParams& Params, const IRMCMovementSceneQuery& Scene)
+{
+    check(States.Num() == Inputs.Num());
+
+    for (int32 Index = 0; Index < States.Num(); ++Index)
+    {
+        States[Index] = Step(States[Index], Inputs[Index], Params, Scene, Index);
+    }
+}
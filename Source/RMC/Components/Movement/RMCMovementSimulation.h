@@ -0,0 +1,147 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Movement mode as tracked by the simulation core
+ */
+enum class ERMCMovementSimMode : uint8
+{
+    Walking,
+    Falling,
+    WallRunning,
+    Sliding,
+    Dashing
+};
+
+/**
+ * Tuning values read by the movement rules. Mirrors the physics properties on URMCMovementComponent.
+ */
+struct RMC_API FRMCMovementParams
+{
+    // Wall Running
+    float WallRunSpeed = 800.0f;
+    float WallRunGravityScale = 0.25f;
+    float WallRunControlMultiplier = 0.5f;
+    float WallAttractionForce = 200.0f;
+
+    // Sliding
+    float SlideSpeed = 1200.0f;
+    float SlideFriction = 0.2f;
+    float SlideMinSpeed = 200.0f;
+    float SlideDownhillAccelerationMultiplier = 2.0f;
+
+    // Dashing
+    float DashDistance = 500.0f;
+    float DashDuration = 0.2f;
+
+    // Momentum
+    float MaxMomentum = 100.0f;
+    float MomentumBuildRate = 10.0f;
+    float MomentumDecayRate = 5.0f;
+
+    // Speed Cap
+    float GlobalSpeedCap = 3000.0f;
+    float SpeedCapDamping = 0.8f;
+    bool bApplySpeedCapToZVelocity = false;
+
+    // Base movement
+    float MaxWalkSpeed = 600.0f;
+    float GravityZ = -980.0f;
+};
+
+/**
+ * Per-agent state the movement rules transform
+ */
+struct RMC_API FRMCMovementSimState
+{
+    FVector Velocity = FVector::ZeroVector;
+    float Momentum = 0.0f;
+    ERMCMovementSimMode Mode = ERMCMovementSimMode::Walking;
+    FVector WallNormal = FVector::ZeroVector;
+    FVector DashDirection = FVector::ZeroVector;
+};
+
+/**
+ * Per-step input for an agent
+ */
+struct RMC_API FRMCMovementSimInput
+{
+    // World-space movement input, already consumed from the owner
+    FVector MoveInput = FVector::ZeroVector;
+    float DeltaTime = 0.0f;
+};
+
+/**
+ * Scene queries the movement rules depend on. The component answers these from the world;
+ * tests and batch runs can supply their own.
+ */
+class RMC_API IRMCMovementSceneQuery
+{
+public:
+    virtual ~IRMCMovementSceneQuery() = default;
+
+    /** Looks for a wall the agent can run on */
+    virtual bool FindWall(int32 AgentIndex, const FRMCMovementSimState& State, FVector& OutWallNormal) const = 0;
+
+    /** Normal of the floor under the agent */
+    virtual FVector GetFloorNormal(int32 AgentIndex, const FRMCMovementSimState& State) const = 0;
+
+    /** Whether the agent is standing on walkable ground */
+    virtual bool IsMovingOnGround(int32 AgentIndex, const FRMCMovementSimState& State) const = 0;
+};
+
+/**
+ * Flat, wall-less scene for running the rules without a world
+ */
+class RMC_API FRMCFlatGroundSceneQuery : public IRMCMovementSceneQuery
+{
+public:
+    virtual bool FindWall(int32 AgentIndex, const FRMCMovementSimState& State, FVector& OutWallNormal) const override { return false; }
+    virtual FVector GetFloorNormal(int32 AgentIndex, const FRMCMovementSimState& State) const override { return FVector::UpVector; }
+    virtual bool IsMovingOnGround(int32 AgentIndex, const FRMCMovementSimState& State) const override { return State.Mode != ERMCMovementSimMode::Falling; }
+};
+
+/**
+ * Pure state-transition rules for RMC movement.
+ * Nothing here touches UObjects, the world, debug output or delegates, so the rules can be stepped
+ * for thousands of agents in tight loops and exercised without a world.
+ */
+struct RMC_API FRMCMovementSimulation
+{
+    /** Velocity after one step of wall running along the wall with the given normal */
+    static FVector ApplyWallRunForces(const FRMCMovementParams& Params, const FVector& Velocity, const FVector& WallNormal,
+        const FVector& MoveInput, float DeltaTime);
+
+    /** Velocity after one step of sliding over a floor with the given normal */
+    static FVector ApplySlideForces(const FRMCMovementParams& Params, const FVector& Velocity, const FVector& FloorNormal,
+        const FVector& MoveInput, float DeltaTime);
+
+    /** Constant dash velocity */
+    static FVector ApplyDashForces(const FRMCMovementParams& Params, const FVector& DashDirection);
+
+    /** Signed momentum change for one step: builds at high speed, decays at low speed */
+    static float ComputeMomentumDelta(const FRMCMovementParams& Params, const FVector& Velocity, float DeltaTime);
+
+    /** Momentum after applying a change, clamped to [0, MaxMomentum] */
+    static float ApplyMomentumDelta(const FRMCMovementParams& Params, float Momentum, float Delta);
+
+    /** Damps velocity toward the global speed cap. Returns true if the cap was applied. */
+    static bool ApplySpeedCap(const FRMCMovementParams& Params, FVector& InOutVelocity, float& OutPreviousSpeed, float& OutNewSpeed);
+
+    /** Wall runs end when the wall is lost or the character has all but stopped */
+    static bool ShouldEndWallRun(const FVector& Velocity, bool bFoundWall);
+
+    /** Slides end when too slow or no longer on the ground */
+    static bool ShouldEndSlide(const FRMCMovementParams& Params, const FVector& Velocity, bool bOnGround);
+
+    /** Runs one full step for a single agent: speed cap, mode forces, momentum and mode exits */
+    static FRMCMovementSimState Step(const FRMCMovementSimState& State, const FRMCMovementSimInput& Input,
+        const FRMCMovementParams& Params, const IRMCMovementSceneQuery& Scene, int32 AgentIndex = 0);
+
+    /** Steps every agent in place. Inputs must have one entry per state. */
+    static void StepBatch(TArrayView<FRMCMovementSimState> States, TArrayView<const FRMCMovementSimInput> Inputs,
+        const FRMCMovementParams& Params, const IRMCMovementSceneQuery& Scene);
+};
@@ -0,0 +1,229 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMovementSimulation.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RMCMovementSimulationTests
+{
+    constexpr float Tolerance = 0.01f;
+
+    /** Flat ground with a wall beside every agent, so wall runs can continue */
+    class FWallSceneQuery : public FRMCFlatGroundSceneQuery
+    {
+    public:
+        explicit FWallSceneQuery(const FVector& InWallNormal) : WallNormal(InWallNormal) {}
+
+        virtual bool FindWall(int32 AgentIndex, const FRMCMovementSimState& State, FVector& OutWallNormal) const override
+        {
+            OutWallNormal = WallNormal;
+            return true;
+        }
+
+    private:
+        FVector WallNormal;
+    };
+
+    static FRMCMovementSimState MakeState(ERMCMovementSimMode Mode, const FVector& Velocity, float Momentum = 50.0f)
+    {
+        FRMCMovementSimState State;
+        State.Mode = Mode;
+        State.Velocity = Velocity;
+        State.Momentum = Momentum;
+        return State;
+    }
+
+    static FRMCMovementSimInput MakeInput(float DeltaTime, const FVector& MoveInput = FVector::ZeroVector)
+    {
+        FRMCMovementSimInput Input;
+        Input.DeltaTime = DeltaTime;
+        Input.MoveInput = MoveInput;
+        return Input;
+    }
+}
+
+using namespace RMCMovementSimulationTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRMCMovementSimulationWalkingTest, "RMC.Movement.Simulation.Walking",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRMCMovementSimulationWalkingTest::RunTest(const FString& Parameters)
+{
+    const FRMCMovementParams Params;
+    const FRMCFlatGroundSceneQuery Scene;
+
+    // Standing still decays momentum and leaves velocity alone
+    const FRMCMovementSimState Idle = FRMCMovementSimulation::Step(MakeState(ERMCMovementSimMode::Walking, FVector::ZeroVector), MakeInput(0.1f), Params, Scene);
+    TestEqual(TEXT("Idle momentum decays"), Idle.Momentum, 50.0f - Params.MomentumDecayRate * 0.1f, Tolerance);
+    TestTrue(TEXT("Idle velocity unchanged"), Idle.Velocity.IsZero());
+    TestTrue(TEXT("Idle stays walking"), Idle.Mode == ERMCMovementSimMode::Walking);
+
+    // Running well above walking speed builds momentum
+    const FRMCMovementSimState Running = FRMCMovementSimulation::Step(MakeState(ERMCMovementSimMode::Walking, FVector(1000.0f, 0.0f, 0.0f)), MakeInput(0.1f), Params, Scene);
+    TestEqual(TEXT("Running momentum builds"), Running.Momentum, 50.0f + Params.MomentumBuildRate * 0.1f, Tolerance);
+    TestEqual(TEXT("Running velocity unchanged"), Running.Velocity, FVector(1000.0f, 0.0f, 0.0f), Tolerance);
+
+    // Momentum stays within [0, MaxMomentum]
+    const FRMCMovementSimState Empty = FRMCMovementSimulation::Step(MakeState(ERMCMovementSimMode::Walking, FVector::ZeroVector, 0.1f), MakeInput(1.0f), Params, Scene);
+    TestEqual(TEXT("Momentum floors at zero"), Empty.Momentum, 0.0f);
+    const FRMCMovementSimState Full = FRMCMovementSimulation::Step(MakeState(ERMCMovementSimMode::Walking, FVector(1000.0f, 0.0f, 0.0f), Params.MaxMomentum), MakeInput(1.0f), Params, Scene);
+    TestEqual(TEXT("Momentum caps at MaxMomentum"), Full.Momentum, Params.MaxMomentum);
+
+    // Above the cap, horizontal speed is damped toward it and Z is left alone
+    const FRMCMovementSimState Capped = FRMCMovementSimulation::Step(MakeState(ERMCMovementSimMode::Walking, FVector(4000.0f, 0.0f, 500.0f)), MakeInput(0.1f), Params, Scene);
+    const float CappedSpeed = FMath::Lerp(4000.0f, Params.GlobalSpeedCap, 1.0f - Params.SpeedCapDamping);
+    TestEqual(TEXT("Speed cap damps horizontal speed"), Capped.Velocity, FVector(CappedSpeed, 0.0f, 500.0f), Tolerance);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRMCMovementSimulationFallingTest, "RMC.Movement.Simulation.Falling",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRMCMovementSimulationFallingTest::RunTest(const FString& Parameters)
+{
+    const FRMCMovementParams Params;
+    const FRMCFlatGroundSceneQuery Scene;
+
+    // Gravity belongs to the engine's falling physics, so the rules leave a fall as it is
+    const FVector Velocity(100.0f, 0.0f, -300.0f);
+    const FRMCMovementSimState Result = FRMCMovementSimulation::Step(MakeState(ERMCMovementSimMode::Falling, Velocity), MakeInput(0.1f), Params, Scene);
+    TestEqual(TEXT("Falling velocity unchanged"), Result.Velocity, Velocity, Tolerance);
+    TestTrue(TEXT("Stays falling"), Result.Mode == ERMCMovementSimMode::Falling);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRMCMovementSimulationWallRunTest, "RMC.Movement.Simulation.WallRun",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRMCMovementSimulationWallRunTest::RunTest(const FString& Parameters)
+{
+    const FRMCMovementParams Params;
+    const FVector WallNormal(0.0f, 1.0f, 0.0f);
+    const FWallSceneQuery WallScene(WallNormal);
+    const float DeltaTime = 0.1f;
+
+    FRMCMovementSimState State = MakeState(ERMCMovementSimMode::WallRunning, FVector(500.0f, 0.0f, 0.0f));
+    State.WallNormal = WallNormal;
+
+    // Wall run speed along the wall, one step of scaled gravity and the pull toward the wall
+    const FVector Expected(Params.WallRunSpeed, -Params.WallAttractionForce * DeltaTime, Params.GravityZ * Params.WallRunGravityScale * DeltaTime);
+    const FRMCMovementSimState First = FRMCMovementSimulation::Step(State, MakeInput(DeltaTime), Params, WallScene);
+    TestEqual(TEXT("Wall run velocity"), First.Velocity, Expected, Tolerance);
+    TestTrue(TEXT("Stays wall running beside a wall"), First.Mode == ERMCMovementSimMode::WallRunning);
+
+    // Velocity is rebuilt every step, so the fall rate does not accumulate
+    const FRMCMovementSimState Second = FRMCMovementSimulation::Step(First, MakeInput(DeltaTime), Params, WallScene);
+    TestEqual(TEXT("Wall run velocity holds"), Second.Velocity, Expected, Tolerance);
+
+    // Pressing along the run direction speeds it up
+    const FRMCMovementSimState Boosted = FRMCMovementSimulation::Step(State, MakeInput(DeltaTime, FVector(1.0f, 0.0f, 0.0f)), Params, WallScene);
+    TestTrue(TEXT("Forward input speeds up the wall run"), Boosted.Velocity.X > Expected.X);
+
+    // Losing the wall drops into a fall
+    const FRMCMovementSimState Lost = FRMCMovementSimulation::Step(State, MakeInput(DeltaTime), Params, FRMCFlatGroundSceneQuery());
+    TestTrue(TEXT("Ends without a wall"), Lost.Mode == ERMCMovementSimMode::Falling);
+    TestTrue(TEXT("Wall normal cleared"), Lost.WallNormal.IsZero());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRMCMovementSimulationSlideTest, "RMC.Movement.Simulation.Slide",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRMCMovementSimulationSlideTest::RunTest(const FString& Parameters)
+{
+    const FRMCMovementParams Params;
+    const FRMCFlatGroundSceneQuery Scene;
+    const float DeltaTime = 0.1f;
+
+    // Friction proportional to speed on flat ground
+    const FRMCMovementSimState Sliding = FRMCMovementSimulation::Step(MakeState(ERMCMovementSimMode::Sliding, FVector(1000.0f, 0.0f, 0.0f)), MakeInput(DeltaTime), Params, Scene);
+    TestEqual(TEXT("Slide friction"), Sliding.Velocity, FVector(1000.0f * (1.0f - Params.SlideFriction * DeltaTime), 0.0f, 0.0f), Tolerance);
+    TestTrue(TEXT("Keeps sliding"), Sliding.Mode == ERMCMovementSimMode::Sliding);
+
+    // Never faster than SlideSpeed
+    const FRMCMovementSimState Fast = FRMCMovementSimulation::Step(MakeState(ERMCMovementSimMode::Sliding, FVector(2000.0f, 0.0f, 0.0f)), MakeInput(DeltaTime), Params, Scene);
+    TestEqual(TEXT("Slide speed capped"), Fast.Velocity.Size2D(), Params.SlideSpeed, Tolerance);
+
+    // Too slow to slide ends it on the ground
+    const FRMCMovementSimState Stopped = FRMCMovementSimulation::Step(MakeState(ERMCMovementSimMode::Sliding, FVector::ZeroVector), MakeInput(DeltaTime), Params, Scene);
+    TestTrue(TEXT("Ends into walking"), Stopped.Mode == ERMCMovementSimMode::Walking);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRMCMovementSimulationDashTest, "RMC.Movement.Simulation.Dash",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRMCMovementSimulationDashTest::RunTest(const FString& Parameters)
+{
+    const FRMCMovementParams Params;
+    const FRMCFlatGroundSceneQuery Scene;
+
+    FRMCMovementSimState State = MakeState(ERMCMovementSimMode::Dashing, FVector(100.0f, 0.0f, 0.0f));
+    State.DashDirection = FVector(0.0f, 1.0f, 0.0f);
+
+    // Constant DashDistance / DashDuration along the dash, whatever the velocity was
+    const FRMCMovementSimState Result = FRMCMovementSimulation::Step(State, MakeInput(0.05f), Params, Scene);
+    TestEqual(TEXT("Dash velocity"), Result.Velocity, FVector(0.0f, Params.DashDistance / Params.DashDuration, 0.0f), Tolerance);
+    TestTrue(TEXT("Stays dashing until the caller times it out"), Result.Mode == ERMCMovementSimMode::Dashing);
+    TestEqual(TEXT("Dashing builds momentum"), Result.Momentum, 50.0f + Params.MomentumBuildRate * 0.05f, Tolerance);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRMCMovementSimulationBatchTest, "RMC.Movement.Simulation.StepBatchMatchesStep",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRMCMovementSimulationBatchTest::RunTest(const FString& Parameters)
+{
+    const FRMCMovementParams Params;
+    const FRMCFlatGroundSceneQuery Scene;
+
+    // One agent per mode, with varied speeds, inputs and step lengths
+    TArray<FRMCMovementSimState> States;
+    TArray<FRMCMovementSimInput> Inputs;
+
+    States.Add(MakeState(ERMCMovementSimMode::Walking, FVector(4000.0f, 200.0f, 0.0f), 10.0f));
+    Inputs.Add(MakeInput(1.0f / 60.0f, FVector(1.0f, 0.0f, 0.0f)));
+
+    States.Add(MakeState(ERMCMovementSimMode::Falling, FVector(300.0f, -100.0f, -800.0f), 90.0f));
+    Inputs.Add(MakeInput(1.0f / 30.0f));
+
+    FRMCMovementSimState WallRunning = MakeState(ERMCMovementSimMode::WallRunning, FVector(-600.0f, 0.0f, 50.0f));
+    WallRunning.WallNormal = FVector(0.0f, -1.0f, 0.0f);
+    States.Add(WallRunning);
+    Inputs.Add(MakeInput(1.0f / 60.0f, FVector(-1.0f, 0.0f, 0.0f)));
+
+    States.Add(MakeState(ERMCMovementSimMode::Sliding, FVector(700.0f, 700.0f, 0.0f), 0.0f));
+    Inputs.Add(MakeInput(1.0f / 120.0f, FVector(0.0f, 1.0f, 0.0f)));
+
+    FRMCMovementSimState Dashing = MakeState(ERMCMovementSimMode::Dashing, FVector::ZeroVector, 100.0f);
+    Dashing.DashDirection = FVector(0.6f, 0.8f, 0.0f);
+    States.Add(Dashing);
+    Inputs.Add(MakeInput(1.0f / 60.0f));
+
+    TArray<FRMCMovementSimState> Expected;
+    for (int32 Index = 0; Index < States.Num(); ++Index)
+    {
+        Expected.Add(FRMCMovementSimulation::Step(States[Index], Inputs[Index], Params, Scene, Index));
+    }
+
+    FRMCMovementSimulation::StepBatch(States, Inputs, Params, Scene);
+
+    for (int32 Index = 0; Index < States.Num(); ++Index)
+    {
+        const FString Agent = FString::Printf(TEXT("Agent %d"), Index);
+        TestTrue(Agent + TEXT(" mode"), States[Index].Mode == Expected[Index].Mode);
+        TestEqual(Agent + TEXT(" velocity"), States[Index].Velocity, Expected[Index].Velocity, 0.0f);
+        TestEqual(Agent + TEXT(" momentum"), States[Index].Momentum, Expected[Index].Momentum, 0.0f);
+        TestEqual(Agent + TEXT(" wall normal"), States[Index].WallNormal, Expected[Index].WallNormal, 0.0f);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RMCMovementTimers.h"
+#include <type_traits>
+
+/**
+ * Everything needed to put an RMC character back exactly where it was at the start of a simulation frame.
+ * Plain data with no pointers, so capturing and restoring is a copy.
+ */
+struct RMC_API FRMCMovementSnapshot
+{
+    // Transform and physics
+    FVector Location = FVector::ZeroVector;
+    FQuat Rotation = FQuat::Identity;
+    FVector Velocity = FVector::ZeroVector;
+    float CapsuleHalfHeight = 0.0f;
+
+    // Engine movement mode
+    uint8 MovementMode = 0;
+    uint8 CustomMovementMode = 0;
+
+    // Jump state kept on the character
+    uint8 bPressedJump : 1;
+    int32 JumpCurrentCount = 0;
+    float JumpKeyHoldTime = 0.0f;
+    float JumpForceTimeRemaining = 0.0f;
+
+    // RMC state
+    uint8 bIsWallRunning : 1;
+    uint8 bIsSliding : 1;
+    uint8 bIsDashing : 1;
+    uint8 bHasDoubleJumped : 1;
+    float Momentum = 0.0f;
+    FVector WallNormal = FVector::ZeroVector;
+    FVector DashDirection = FVector::ZeroVector;
+
+    // Cooldowns and durations
+    FRMCMovementTimerWheel Timers;
+
+    FRMCMovementSnapshot()
+        : bPressedJump(false)
+        , bIsWallRunning(false)
+        , bIsSliding(false)
+        , bIsDashing(false)
+        , bHasDoubleJumped(false)
+    {
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<FRMCMovementSnapshot>, "Snapshots are copied with memcpy semantics and must stay plain data");
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMovementSubsystem.h"
+#include "RMCMovementComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+void URMCMovementSubsystem::Deinitialize()
+{
+    Components.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId URMCMovementSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(URMCMovementSubsystem, STATGROUP_Tickables);
+}
+
+void URMCMovementSubsystem::RegisterComponent(URMCMovementComponent* Component)
+{
+    Components.AddUnique(Component);
+}
+
+void URMCMovementSubsystem::UnregisterComponent(URMCMovementComponent* Component)
+{
+    Components.RemoveSwap(Component);
+}
+
+void URMCMovementSubsystem::Tick(float DeltaTime)
+{
+    // Ticks after every actor and component, so this sees the frame's movement
+    if (Components.Num() > 0)
+    {
+        URMCMovementComponent::UpdateBookkeepingBatched(ToRawPtrTArrayUnsafe(Components), DeltaTime, Scratch);
+    }
+}
+
+void URMCMovementSubsystem::SetBatchedBookkeeping(bool bBatched)
+{
+    for (URMCMovementComponent* Component : Components)
+    {
+        if (IsValid(Component))
+        {
+            Component->bUseBatchedBookkeeping = bBatched;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Console commands
+
+namespace RMCMovementCommands
+{
+    static FAutoConsoleCommandWithWorldAndArgs BatchedCommand(
+        TEXT("rmc.Movement.Batched"),
+        TEXT("Moves every RMC movement component's momentum, speed cap and timers onto or off the batched pass. Usage: rmc.Movement.Batched [0|1]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            URMCMovementSubsystem* Subsystem = World ? World->GetSubsystem<URMCMovementSubsystem>() : nullptr;
+            if (!Subsystem)
+            {
+                return;
+            }
+
+            const bool bBatched = Args.Num() == 0 || FCString::ToBool(*Args[0]);
+            Subsystem->SetBatchedBookkeeping(bBatched);
+            UE_LOG(LogTemp, Display, TEXT("RMC movement bookkeeping %s for %d components"), bBatched ? TEXT("batched") : TEXT("per component"),
+                Subsystem->GetNumComponents());
+        }));
+}
@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RMCMovementBatch.h"
+#include "RMCMovementSubsystem.generated.h"
+
+class URMCMovementComponent;
+
+/**
+ * Runs the per-frame bookkeeping of every RMC movement component with bUseBatchedBookkeeping in one pass
+ * after movement has ticked: momentum and the speed cap over packed arrays, then the movement timers,
+ * then momentum events. Every URMCMovementComponent registers here.
+ */
+UCLASS()
+class RMC_API URMCMovementSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterComponent(URMCMovementComponent* Component);
+
+    void UnregisterComponent(URMCMovementComponent* Component);
+
+    /** Moves every registered component onto or off the batched pass */
+    void SetBatchedBookkeeping(bool bBatched);
+
+    int32 GetNumComponents() const { return Components.Num(); }
+
+private:
+    UPROPERTY()
+    TArray<TObjectPtr<URMCMovementComponent>> Components;
+
+    // Reused every frame so the packed arrays are only allocated as the character count grows
+    FRMCMovementBookkeepingBatch Scratch;
+};
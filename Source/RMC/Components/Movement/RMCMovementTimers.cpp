@@ -0,0 +1,160 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMovementTimers.h"
+
+static_assert(FRMCMovementTimerWheel::MaxTimers <= 32, "Timer masks are 32 bits wide");
+static_assert((FRMCMovementTimerWheel::NumSlots & (FRMCMovementTimerWheel::NumSlots - 1)) == 0, "Slot count must be a power of two");
+static_assert(static_cast<int32>(ERMCMovementTimer::FirstCustom) < FRMCMovementTimerWheel::MaxTimers, "Too many built-in timers");
+
+FRMCMovementTimerWheel::FRMCMovementTimerWheel()
+{
+    Reset();
+}
+
+void FRMCMovementTimerWheel::Reset()
+{
+    Time = 0.0;
+    CurrentTick = 0;
+    ActiveMask = 0;
+    FMemory::Memzero(ExpireTimes);
+    FMemory::Memzero(SlotMasks);
+}
+
+void FRMCMovementTimerWheel::Set(uint8 TimerId, float Duration)
+{
+    if (!ensure(TimerId < MaxTimers))
+    {
+        return;
+    }
+
+    if (IsActive(TimerId))
+    {
+        Unlink(TimerId);
+    }
+
+    ExpireTimes[TimerId] = Time + FMath::Max(Duration, 0.0f);
+    Link(TimerId);
+}
+
+void FRMCMovementTimerWheel::Clear(uint8 TimerId)
+{
+    if (IsActive(TimerId))
+    {
+        Unlink(TimerId);
+    }
+}
+
+float FRMCMovementTimerWheel::GetRemaining(uint8 TimerId) const
+{
+    if (!IsActive(TimerId))
+    {
+        return 0.0f;
+    }
+
+    return static_cast<float>(FMath::Max(ExpireTimes[TimerId] - Time, 0.0));
+}
+
+void FRMCMovementTimerWheel::Link(uint8 TimerId)
+{
+    const uint32 Bit = 1u << TimerId;
+    ActiveMask |= Bit;
+    SlotMasks[ToTick(ExpireTimes[TimerId]) & (NumSlots - 1)] |= Bit;
+}
+
+void FRMCMovementTimerWheel::Unlink(uint8 TimerId)
+{
+    const uint32 Bit = 1u << TimerId;
+    ActiveMask &= ~Bit;
+    SlotMasks[ToTick(ExpireTimes[TimerId]) & (NumSlots - 1)] &= ~Bit;
+}
+
+void FRMCMovementTimerWheel::Advance(float DeltaTime, TFunctionRef<void(uint8 TimerId)> OnExpired)
+{
+    Time += FMath::Max(DeltaTime, 0.0f);
+    const int64 NewTick = ToTick(Time);
+
+    // Gather candidates from every slot passed since the last advance. The current slot is revisited
+    // because timers later in the same tick were left in it last time.
+    uint32 CandidateMask = 0;
+    if (NewTick - CurrentTick >= NumSlots)
+    {
+        CandidateMask = ActiveMask;
+    }
+    else
+    {
+        for (int64 Tick = CurrentTick; Tick <= NewTick; ++Tick)
+        {
+            CandidateMask |= SlotMasks[Tick & (NumSlots - 1)];
+        }
+    }
+    CurrentTick = NewTick;
+
+    // Slots are shared across revolutions, so check the actual expiry time
+    TArray<uint8, TInlineAllocator<MaxTimers>> Expired;
+    while (CandidateMask != 0)
+    {
+        const uint8 TimerId = static_cast<uint8>(FMath::CountTrailingZeros(CandidateMask));
+        CandidateMask &= CandidateMask - 1;
+
+        if (ExpireTimes[TimerId] <= Time)
+        {
+            Expired.Add(TimerId);
+        }
+    }
+
+    if (Expired.Num() == 0)
+    {
+        return;
+    }
+
+    Expired.Sort([this](uint8 A, uint8 B)
+    {
+        return ExpireTimes[A] != ExpireTimes[B] ? ExpireTimes[A] < ExpireTimes[B] : A < B;
+    });
+
+    for (const uint8 TimerId : Expired)
+    {
+        // An earlier callback may have cleared or restarted this timer
+        if (!IsActive(TimerId) || ExpireTimes[TimerId] > Time)
+        {
+            continue;
+        }
+
+        Unlink(TimerId);
+        OnExpired(TimerId);
+    }
+}
+
+bool FRMCMovementTimerWheel::Serialize(FArchive& Ar)
+{
+    Ar << Time;
+    Ar << ActiveMask;
+
+    for (int32 TimerId = 0; TimerId < MaxTimers; ++TimerId)
+    {
+        if (ActiveMask & (1u << TimerId))
+        {
+            Ar << ExpireTimes[TimerId];
+        }
+    }
+
+    if (Ar.IsLoading())
+    {
+        CurrentTick = ToTick(Time);
+        FMemory::Memzero(SlotMasks);
+
+        for (int32 TimerId = 0; TimerId < MaxTimers; ++TimerId)
+        {
+            if (ActiveMask & (1u << TimerId))
+            {
+                SlotMasks[ToTick(ExpireTimes[TimerId]) & (NumSlots - 1)] |= 1u << TimerId;
+            }
+            else
+            {
+                ExpireTimes[TimerId] = 0.0;
+            }
+        }
+    }
+
+    return true;
+}
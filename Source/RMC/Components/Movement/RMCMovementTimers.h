@@ -0,0 +1,88 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Built-in movement timers. Abilities can add their own ids from FirstCustom up to
+ * FRMCMovementTimerWheel::MaxTimers - 1.
+ */
+enum class ERMCMovementTimer : uint8
+{
+    DashCooldown,
+    Dash,
+    WallRun,
+    Slide,
+    SlideMinDuration,
+
+    FirstCustom
+};
+
+/**
+ * Fixed-size timing wheel for ability cooldowns and durations, driven by simulation time rather than
+ * world time. Timers hash into slots by expiry tick, so advancing only visits the slots that have passed
+ * instead of polling every timer. Holds no pointers, so it can be copied into prediction snapshots and
+ * serialized for replays.
+ */
+struct RMC_API FRMCMovementTimerWheel
+{
+    static constexpr int32 MaxTimers = 32;
+    static constexpr int32 NumSlots = 64;
+    static constexpr double TickSeconds = 1.0 / 120.0;
+
+    FRMCMovementTimerWheel();
+
+    /** Starts or restarts a timer that expires Duration seconds from the current simulation time */
+    void Set(uint8 TimerId, float Duration);
+    void Set(ERMCMovementTimer Timer, float Duration) { Set(static_cast<uint8>(Timer), Duration); }
+
+    /** Stops a timer without firing it */
+    void Clear(uint8 TimerId);
+    void Clear(ERMCMovementTimer Timer) { Clear(static_cast<uint8>(Timer)); }
+
+    bool IsActive(uint8 TimerId) const { return TimerId < MaxTimers && (ActiveMask & (1u << TimerId)) != 0; }
+    bool IsActive(ERMCMovementTimer Timer) const { return IsActive(static_cast<uint8>(Timer)); }
+
+    /** Seconds until the timer expires, or 0 if it isn't running */
+    float GetRemaining(uint8 TimerId) const;
+    float GetRemaining(ERMCMovementTimer Timer) const { return GetRemaining(static_cast<uint8>(Timer)); }
+
+    /**
+     * Moves simulation time forward and calls OnExpired for every timer that ran out, earliest first.
+     * The callback may set or clear timers, including ones that expired in the same step.
+     */
+    void Advance(float DeltaTime, TFunctionRef<void(uint8 TimerId)> OnExpired);
+
+    /** Stops every timer and rewinds simulation time to zero */
+    void Reset();
+
+    double GetTime() const { return Time; }
+
+    /** Saves or loads the running timers. Slot assignments are rebuilt on load. */
+    bool Serialize(FArchive& Ar);
+
+    friend FArchive& operator<<(FArchive& Ar, FRMCMovementTimerWheel& Wheel)
+    {
+        Wheel.Serialize(Ar);
+        return Ar;
+    }
+
+private:
+    static int64 ToTick(double InTime) { return FMath::FloorToInt64(InTime / TickSeconds); }
+
+    void Link(uint8 TimerId);
+    void Unlink(uint8 TimerId);
+
+    // Current simulation time and the wheel tick it falls in
+    double Time;
+    int64 CurrentTick;
+
+    // One bit per running timer
+    uint32 ActiveMask;
+
+    double ExpireTimes[MaxTimers];
+
+    // One bit per timer expiring in the slot's ticks, across all revolutions
+    uint32 SlotMasks[NumSlots];
+};
@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCNetworkMoveData.h"
+#include "RMCMovementComponent.h"
+#include "RMCMoveBandwidthStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+/** Current bit position. The character movement component always serializes moves with bit readers and writers. */
+static int64 GetBitPosition(FArchive& Ar)
+{
+    return Ar.IsSaving() ? static_cast<FBitWriter&>(Ar).GetNumBits() : static_cast<FBitReader&>(Ar).GetPosBits();
+}
+
+static void RecordMoveBits(const UCharacterMovementComponent& CharacterMovement, ERMCMoveTraffic Traffic, uint8 SenderMovementMode, int64 NumBits)
+{
+    const URMCMovementComponent* MovementComponent = Cast<URMCMovementComponent>(&CharacterMovement);
+    const UWorld* World = CharacterMovement.GetWorld();
+    if (!MovementComponent || !World)
+    {
+        return;
+    }
+
+    FRMCMoveBandwidthStats::Get().Record(Traffic, MovementComponent->GetPredictedMovementModeFromNetwork(SenderMovementMode), NumBits,
+        World->GetTimeSeconds());
+}
+
+void FRMCCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+    FCharacterNetworkMoveData::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+    // Our prediction data only saves FSavedMove_RMC
+    PhysicsProfileIndex = static_cast<const FSavedMove_RMC&>(ClientMove).PhysicsProfileIndex;
+}
+
+bool FRMCCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+    FCharacterNetworkMoveData::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+    Ar << PhysicsProfileIndex;
+    return !Ar.IsError();
+}
+
+FRMCNetworkMoveDataContainer::FRMCNetworkMoveDataContainer()
+{
+    NewMoveData = &RMCMoveData[0];
+    PendingMoveData = &RMCMoveData[1];
+    OldMoveData = &RMCMoveData[2];
+}
+
+bool FRMCNetworkMoveDataContainer::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap)
+{
+    const int64 StartBits = GetBitPosition(Ar);
+    const bool bResult = FCharacterNetworkMoveDataContainer::Serialize(CharacterMovement, Ar, PackageMap);
+
+    // The new move carries the mode the client was in when it sent the message
+    if (bResult && !Ar.IsError())
+    {
+        RecordMoveBits(CharacterMovement, Ar.IsSaving() ? ERMCMoveTraffic::ServerMoveSent : ERMCMoveTraffic::ServerMoveReceived,
+            GetNewMoveData()->MovementMode, GetBitPosition(Ar) - StartBits);
+    }
+
+    return bResult;
+}
+
+bool FRMCMoveResponseDataContainer::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap)
+{
+    const int64 StartBits = GetBitPosition(Ar);
+    const bool bResult = FCharacterMoveResponseDataContainer::Serialize(CharacterMovement, Ar, PackageMap);
+
+    // A correction carries the server's mode; an acknowledgement doesn't, so use the mode the character is in
+    if (bResult && !Ar.IsError())
+    {
+        const uint8 SenderMovementMode = IsGoodMove() ? CharacterMovement.PackNetworkMovementMode() : ClientAdjustment.MovementMode;
+        RecordMoveBits(CharacterMovement, Ar.IsSaving() ? ERMCMoveTraffic::MoveResponseSent : ERMCMoveTraffic::MoveResponseReceived,
+            SenderMovementMode, GetBitPosition(Ar) - StartBits);
+    }
+
+    return bResult;
+}
+
+void FSavedMove_RMC::Clear()
+{
+    FSavedMove_Character::Clear();
+
+    PhysicsProfileIndex = 0;
+}
+
+void FSavedMove_RMC::SetMoveFor(ACharacter* Character, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+    FSavedMove_Character::SetMoveFor(Character, InDeltaTime, NewAccel, ClientData);
+
+    if (const URMCMovementComponent* MovementComponent = Cast<URMCMovementComponent>(Character->GetCharacterMovement()))
+    {
+        PhysicsProfileIndex = MovementComponent->GetPhysicsProfileIndex();
+    }
+}
+
+bool FSavedMove_RMC::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+    // A switch has to stay on the step it happened
+    if (PhysicsProfileIndex != static_cast<const FSavedMove_RMC*>(NewMove.Get())->PhysicsProfileIndex)
+    {
+        return false;
+    }
+
+    return FSavedMove_Character::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_RMC::PrepMoveFor(ACharacter* Character)
+{
+    FSavedMove_Character::PrepMoveFor(Character);
+
+    URMCMovementComponent* MovementComponent = Cast<URMCMovementComponent>(Character->GetCharacterMovement());
+    if (MovementComponent && MovementComponent->GetPhysicsProfileIndex() != PhysicsProfileIndex)
+    {
+        MovementComponent->ApplyPhysicsProfileIndex(PhysicsProfileIndex);
+    }
+}
+
+FNetworkPredictionData_Client_RMC::FNetworkPredictionData_Client_RMC(const UCharacterMovementComponent& ClientMovement)
+    : FNetworkPredictionData_Client_Character(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_RMC::AllocateNewMove()
+{
+    return FSavedMovePtr(new FSavedMove_RMC());
+}
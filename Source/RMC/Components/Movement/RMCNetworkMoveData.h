@@ -0,0 +1,67 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/CharacterMovementReplication.h"
+
+/**
+ * Client move with the physics profile it was made with, so the server switches profile at the same step
+ */
+struct RMC_API FRMCCharacterNetworkMoveData : public FCharacterNetworkMoveData
+{
+    // URMCMovementComponent::GetPhysicsProfileIndex when the move was made
+    uint8 PhysicsProfileIndex = 0;
+
+    virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+};
+
+/**
+ * Client-to-server move container. Carries FRMCCharacterNetworkMoveData, and measures each message
+ * for FRMCMoveBandwidthStats as it serializes.
+ */
+struct RMC_API FRMCNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+    FRMCNetworkMoveDataContainer();
+
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap) override;
+
+private:
+    // New, pending and old move
+    FRMCCharacterNetworkMoveData RMCMoveData[3];
+};
+
+/**
+ * Server-to-client move response container, measured the same way
+ */
+struct RMC_API FRMCMoveResponseDataContainer : public FCharacterMoveResponseDataContainer
+{
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap) override;
+};
+
+/**
+ * Saved client move, remembering the physics profile for combining and replay
+ */
+class RMC_API FSavedMove_RMC : public FSavedMove_Character
+{
+public:
+    virtual void Clear() override;
+    virtual void SetMoveFor(ACharacter* Character, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+    virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+    virtual void PrepMoveFor(ACharacter* Character) override;
+
+    uint8 PhysicsProfileIndex = 0;
+};
+
+/**
+ * Client prediction data that saves FSavedMove_RMC
+ */
+class RMC_API FNetworkPredictionData_Client_RMC : public FNetworkPredictionData_Client_Character
+{
+public:
+    explicit FNetworkPredictionData_Client_RMC(const UCharacterMovementComponent& ClientMovement);
+
+    virtual FSavedMovePtr AllocateNewMove() override;
+};
@@ -0,0 +1,214 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCTrajectoryPrediction.h"
+
+namespace RMCTrajectory
+{
+    // Mirrors the speed cap applied in URMCMovementComponent::TickComponent, treated as a hard clamp
+    static FVector ClampHorizontalSpeed(const FVector& Velocity, float SpeedCap)
+    {
+        if (SpeedCap <= 0.0f)
+        {
+            return Velocity;
+        }
+
+        const float HorizontalSpeedSq = Velocity.SizeSquared2D();
+        if (HorizontalSpeedSq <= FMath::Square(SpeedCap))
+        {
+            return Velocity;
+        }
+
+        const float Scale = SpeedCap / FMath::Sqrt(HorizontalSpeedSq);
+        return FVector(Velocity.X * Scale, Velocity.Y * Scale, Velocity.Z);
+    }
+
+    static FVector Ballistic(const FVector& Location, const FVector& Velocity, float GravityZ, float Time)
+    {
+        return Location + Velocity * Time + FVector(0.0f, 0.0f, 0.5f * GravityZ * Time * Time);
+    }
+}
+
+FRMCTrajectorySample FRMCTrajectoryPredictor::EvaluateWalking(const FVector& Location, const FVector& Velocity, float Time)
+{
+    // Without input we can only assume the character keeps its current ground velocity
+    const FVector GroundVelocity(Velocity.X, Velocity.Y, 0.0f);
+
+    FRMCTrajectorySample Sample;
+    Sample.Location = Location + GroundVelocity * Time;
+    Sample.Velocity = GroundVelocity;
+    Sample.Mode = ERMCPredictedMovementMode::Walking;
+    return Sample;
+}
+
+FRMCTrajectorySample FRMCTrajectoryPredictor::EvaluateFalling(const FVector& Location, const FVector& Velocity,
+    const FRMCTrajectoryState& State, float Time, bool bDoubleJumpAvailable)
+{
+    const float GravityZ = State.GravityZ;
+
+    FVector StartLocation = Location;
+    FVector StartVelocity = RMCTrajectory::ClampHorizontalSpeed(Velocity, State.GlobalSpeedCap);
+    float LocalTime = Time;
+
+    // Double jump is assumed to be used at the apex, which gives the longest air time
+    if (bDoubleJumpAvailable)
+    {
+        const float ApexTime = (GravityZ < 0.0f) ? FMath::Max(StartVelocity.Z, 0.0f) / -GravityZ : 0.0f;
+        if (LocalTime > ApexTime)
+        {
+            StartLocation = RMCTrajectory::Ballistic(StartLocation, StartVelocity, GravityZ, ApexTime);
+            StartVelocity.Z = State.DoubleJumpZVelocity;
+            LocalTime -= ApexTime;
+        }
+    }
+
+    FRMCTrajectorySample Sample;
+    Sample.Location = RMCTrajectory::Ballistic(StartLocation, StartVelocity, GravityZ, LocalTime);
+    Sample.Velocity = StartVelocity + FVector(0.0f, 0.0f, GravityZ * LocalTime);
+    Sample.Mode = ERMCPredictedMovementMode::Falling;
+    return Sample;
+}
+
+FRMCTrajectorySample FRMCTrajectoryPredictor::Evaluate(const FRMCTrajectoryState& State, float Time, bool bAssumeDoubleJump)
+{
+    Time = FMath::Max(Time, 0.0f);
+    const bool bDoubleJumpAvailable = bAssumeDoubleJump && State.bCanDoubleJump;
+
+    FRMCTrajectorySample Sample;
+
+    switch (State.Mode)
+    {
+    case ERMCPredictedMovementMode::Dashing:
+    {
+        // Constant speed along the dash direction until the dash timeout fires
+        const FVector DashVelocity = State.DashDirection * State.DashSpeed;
+        const float DashTime = FMath::Max(State.DashTimeRemaining, 0.0f);
+
+        if (Time <= DashTime)
+        {
+            Sample.Location = State.Location + DashVelocity * Time;
+            Sample.Velocity = DashVelocity;
+            Sample.Mode = ERMCPredictedMovementMode::Dashing;
+            break;
+        }
+
+        const FVector ExitLocation = State.Location + DashVelocity * DashTime;
+        const FVector ExitVelocity = DashVelocity + State.DashDirection * State.DashExitSpeedBoost;
+        Sample = EvaluateFalling(ExitLocation, ExitVelocity, State, Time - DashTime, bDoubleJumpAvailable);
+        break;
+    }
+
+    case ERMCPredictedMovementMode::WallRunning:
+    {
+        // Constant velocity along the wall. FRMCMovementSimulation::ApplyWallRunForces rebuilds the velocity
+        // every step with one step's worth of scaled gravity, so the fall rate stays what the last step set
+        // rather than accumulating.
+        const FVector WallVelocity(
+            State.WallRunDirection.X * State.WallRunSpeed,
+            State.WallRunDirection.Y * State.WallRunSpeed,
+            State.Velocity.Z);
+        const float WallRunTime = FMath::Max(State.WallRunTimeRemaining, 0.0f);
+
+        if (Time <= WallRunTime)
+        {
+            Sample.Location = State.Location + WallVelocity * Time;
+            Sample.Velocity = WallVelocity;
+            Sample.Mode = ERMCPredictedMovementMode::WallRunning;
+            break;
+        }
+
+        // The wall run times out into a regular fall
+        const FVector ExitLocation = State.Location + WallVelocity * WallRunTime;
+        Sample = EvaluateFalling(ExitLocation, WallVelocity, State, Time - WallRunTime, bDoubleJumpAvailable);
+        break;
+    }
+
+    case ERMCPredictedMovementMode::Sliding:
+    {
+        // Friction is proportional to speed, so speed decays exponentially until it is floored at SlideMinSpeed
+        const FVector SlideDirection = State.Velocity.GetSafeNormal2D();
+        const float MinSpeed = State.SlideMinSpeed;
+        const float StartSpeed = FMath::Min(FMath::Max(State.Velocity.Size2D(), MinSpeed), State.SlideSpeed);
+        const float Friction = State.SlideFriction;
+        const float SlideTime = FMath::Min(Time, FMath::Max(State.SlideTimeRemaining, 0.0f));
+
+        float Distance = StartSpeed * SlideTime;
+        float Speed = StartSpeed;
+        if (Friction > KINDA_SMALL_NUMBER && StartSpeed > MinSpeed)
+        {
+            const float FloorTime = (MinSpeed > 0.0f) ? FMath::Loge(StartSpeed / MinSpeed) / Friction : BIG_NUMBER;
+            if (SlideTime <= FloorTime)
+            {
+                Speed = StartSpeed * FMath::Exp(-Friction * SlideTime);
+                Distance = (StartSpeed - Speed) / Friction;
+            }
+            else
+            {
+                Speed = MinSpeed;
+                Distance = (StartSpeed - MinSpeed) / Friction + MinSpeed * (SlideTime - FloorTime);
+            }
+        }
+
+        const FVector ExitLocation = State.Location + SlideDirection * Distance;
+        const FVector ExitVelocity = SlideDirection * Speed;
+
+        if (Time <= SlideTime)
+        {
+            Sample.Location = ExitLocation;
+            Sample.Velocity = ExitVelocity;
+            Sample.Mode = ERMCPredictedMovementMode::Sliding;
+            break;
+        }
+
+        Sample = EvaluateWalking(ExitLocation, ExitVelocity, Time - SlideTime);
+        break;
+    }
+
+    case ERMCPredictedMovementMode::Falling:
+        Sample = EvaluateFalling(State.Location, State.Velocity, State, Time, bDoubleJumpAvailable);
+        break;
+
+    case ERMCPredictedMovementMode::Walking:
+    default:
+        Sample = EvaluateWalking(State.Location, RMCTrajectory::ClampHorizontalSpeed(State.Velocity, State.GlobalSpeedCap), Time);
+        break;
+    }
+
+    Sample.Time = Time;
+    return Sample;
+}
+
+int32 FRMCTrajectoryPredictor::Predict(const FRMCTrajectoryState& State, float Seconds, int32 SampleCount,
+    TArrayView<FRMCTrajectorySample> OutSamples, bool bAssumeDoubleJump)
+{
+    const int32 NumSamples = FMath::Min(SampleCount, OutSamples.Num());
+    if (NumSamples <= 0 || Seconds <= 0.0f)
+    {
+        return 0;
+    }
+
+    const float TimeStep = Seconds / NumSamples;
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        OutSamples[Index] = Evaluate(State, TimeStep * (Index + 1), bAssumeDoubleJump);
+    }
+
+    return NumSamples;
+}
+
+int32 FRMCTrajectoryPredictor::PredictBatch(TArrayView<const FRMCTrajectoryState> States, float Seconds, int32 SampleCount,
+    TArrayView<FRMCTrajectorySample> OutSamples, bool bAssumeDoubleJump)
+{
+    if (SampleCount <= 0 || OutSamples.Num() < States.Num() * SampleCount)
+    {
+        return 0;
+    }
+
+    int32 NumWritten = 0;
+    for (int32 StateIndex = 0; StateIndex < States.Num(); ++StateIndex)
+    {
+        NumWritten += Predict(States[StateIndex], Seconds, SampleCount,
+            OutSamples.Slice(StateIndex * SampleCount, SampleCount), bAssumeDoubleJump);
+    }
+
+    return NumWritten;
+}
@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RMCTrajectoryPrediction.generated.h"
+
+/**
+ * Movement mode as seen by the trajectory predictor
+ */
+UENUM(BlueprintType)
+enum class ERMCPredictedMovementMode : uint8
+{
+    Walking,
+    Falling,
+    WallRunning,
+    Sliding,
+    Dashing
+};
+
+/**
+ * A single predicted point on a character's future path
+ */
+USTRUCT(BlueprintType)
+struct FRMCTrajectorySample
+{
+    GENERATED_BODY()
+
+    // Seconds from now
+    UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+    float Time = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+    FVector Velocity = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+    ERMCPredictedMovementMode Mode = ERMCPredictedMovementMode::Walking;
+};
+
+/**
+ * Snapshot of everything the closed-form predictor needs.
+ * Filled by URMCMovementComponent::MakeTrajectoryState so prediction never touches the world.
+ */
+struct RMC_API FRMCTrajectoryState
+{
+    FVector Location = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    ERMCPredictedMovementMode Mode = ERMCPredictedMovementMode::Walking;
+
+    // Double jump
+    bool bCanDoubleJump = false;
+    float DoubleJumpZVelocity = 600.0f;
+
+    // Wall running
+    FVector WallRunDirection = FVector::ZeroVector;
+    float WallRunSpeed = 800.0f;
+    float WallRunTimeRemaining = 0.0f;
+
+    // Sliding
+    float SlideSpeed = 1200.0f;
+    float SlideFriction = 0.2f;
+    float SlideMinSpeed = 200.0f;
+    float SlideTimeRemaining = 0.0f;
+
+    // Dashing
+    FVector DashDirection = FVector::ZeroVector;
+    float DashSpeed = 0.0f;
+    float DashTimeRemaining = 0.0f;
+    float DashExitSpeedBoost = 0.0f;
+
+    // World
+    float GravityZ = -980.0f;
+    float GlobalSpeedCap = 0.0f;
+};
+
+/**
+ * Analytic evaluation of the RMC movement modes.
+ * Each sample is computed in closed form from the snapshot, so cost is independent of the horizon
+ * and nothing is allocated. Collision is not considered: falling is purely ballistic and walking
+ * is a constant-velocity extrapolation.
+ */
+struct RMC_API FRMCTrajectoryPredictor
+{
+    /** Evaluates the state at Time seconds from the snapshot */
+    static FRMCTrajectorySample Evaluate(const FRMCTrajectoryState& State, float Time, bool bAssumeDoubleJump = false);
+
+    /** Fills OutSamples with SampleCount evenly spaced samples over (0, Seconds]. Returns the number written. */
+    static int32 Predict(const FRMCTrajectoryState& State, float Seconds, int32 SampleCount,
+        TArrayView<FRMCTrajectorySample> OutSamples, bool bAssumeDoubleJump = false);
+
+    /**
+     * Predicts many characters at once. OutSamples is laid out row-major,
+     * SampleCount samples per state, and must hold States.Num() * SampleCount entries.
+     */
+    static int32 PredictBatch(TArrayView<const FRMCTrajectoryState> States, float Seconds, int32 SampleCount,
+        TArrayView<FRMCTrajectorySample> OutSamples, bool bAssumeDoubleJump = false);
+
+private:
+    static FRMCTrajectorySample EvaluateFalling(const FVector& Location, const FVector& Velocity, const FRMCTrajectoryState& State,
+        float Time, bool bDoubleJumpAvailable);
+    static FRMCTrajectorySample EvaluateWalking(const FVector& Location, const FVector& Velocity, float Time);
+};
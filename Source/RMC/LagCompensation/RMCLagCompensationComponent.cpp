@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCLagCompensationComponent.h"
+#include "RMCLagCompensationSubsystem.h"
+#include "../Components/Movement/RMCMovementComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Character.h"
+
+URMCLagCompensationComponent::URMCLagCompensationComponent()
+{
+    // Record where physics and movement left the character this frame
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    PrimaryComponentTick.TickGroup = TG_PostPhysics;
+}
+
+void URMCLagCompensationComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    SetRecording(true);
+}
+
+void URMCLagCompensationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (URMCLagCompensationSubsystem* Subsystem = World->GetSubsystem<URMCLagCompensationSubsystem>())
+        {
+            Subsystem->UnregisterComponent(this);
+        }
+    }
+
+    Buffer.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void URMCLagCompensationComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    RecordPose();
+}
+
+void URMCLagCompensationComponent::SetRecording(bool bRecording)
+{
+    // Only a server has shots from remote players to validate
+    const ENetMode NetMode = GetNetMode();
+    if (NetMode != NM_DedicatedServer && NetMode != NM_ListenServer)
+    {
+        return;
+    }
+
+    URMCLagCompensationSubsystem* Subsystem = GetWorld()->GetSubsystem<URMCLagCompensationSubsystem>();
+    if (bRecording)
+    {
+        if (Subsystem)
+        {
+            Subsystem->RegisterComponent(this);
+            Buffer.MinRecordInterval = FRMCRewindBuffer::GetRecordIntervalFor(Subsystem->MaxRewindSeconds);
+        }
+
+        RecordPose();
+    }
+    else
+    {
+        if (Subsystem)
+        {
+            Subsystem->UnregisterComponent(this);
+        }
+
+        Buffer.Reset();
+    }
+
+    SetComponentTickEnabled(bRecording);
+}
+
+void URMCLagCompensationComponent::RecordPose()
+{
+    const ACharacter* Character = Cast<ACharacter>(GetOwner());
+    const UCapsuleComponent* Capsule = Character ? Character->GetCapsuleComponent() : nullptr;
+    if (!Capsule)
+    {
+        return;
+    }
+
+    ERMCPredictedMovementMode Mode = ERMCPredictedMovementMode::Walking;
+    if (const URMCMovementComponent* MovementComponent = Cast<URMCMovementComponent>(Character->GetCharacterMovement()))
+    {
+        Mode = MovementComponent->GetPredictedMovementMode();
+    }
+
+    Buffer.Radius = Capsule->GetScaledCapsuleRadius();
+    Buffer.Record(GetWorld()->GetTimeSeconds(), Capsule->GetComponentLocation(), Character->GetActorRotation().Yaw,
+        Capsule->GetScaledCapsuleHalfHeight(), Mode);
+}
@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "RMCRewindBuffer.h"
+#include "RMCLagCompensationComponent.generated.h"
+
+/**
+ * Records the owning character's capsule every server frame so hit validation can rewind it to what a
+ * shooter saw. Does nothing on clients or in standalone games.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class RMC_API URMCLagCompensationComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    URMCLagCompensationComponent();
+
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    /** Capsule pose at ServerTime. Returns false if the history doesn't cover ServerTime. */
+    bool GetRewoundPose(double ServerTime, FRMCRewindSample& OutSample) const { return Buffer.Sample(ServerTime, OutSample); }
+
+    const FRMCRewindBuffer& GetBuffer() const { return Buffer; }
+
+    /** Starts or stops recording, e.g. while the character waits in a pool. Stopping drops the history. */
+    void SetRecording(bool bRecording);
+
+private:
+    /** Appends the owner's current capsule pose */
+    void RecordPose();
+
+    FRMCRewindBuffer Buffer;
+};
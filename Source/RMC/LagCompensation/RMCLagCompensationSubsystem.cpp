@@ -0,0 +1,250 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCLagCompensationSubsystem.h"
+#include "RMCLagCompensationComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+URMCLagCompensationSubsystem::URMCLagCompensationSubsystem()
+{
+    ProxyViewDelay = 0.1f;
+    MaxRewindSeconds = 0.5f;
+}
+
+void URMCLagCompensationSubsystem::RegisterComponent(URMCLagCompensationComponent* Component)
+{
+    Components.AddUnique(Component);
+}
+
+void URMCLagCompensationSubsystem::UnregisterComponent(URMCLagCompensationComponent* Component)
+{
+    Components.RemoveSwap(Component);
+}
+
+double URMCLagCompensationSubsystem::GetShooterViewTime(const APlayerController* Shooter) const
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    float RoundTripSeconds = 0.0f;
+    if (Shooter && Shooter->PlayerState)
+    {
+        RoundTripSeconds = Shooter->PlayerState->GetPingInMilliseconds() * 0.001f;
+    }
+
+    const double Rewind = FMath::Min(RoundTripSeconds + ProxyViewDelay, MaxRewindSeconds);
+    return Now - Rewind;
+}
+
+bool URMCLagCompensationSubsystem::RewindLineTrace(const FVector& Start, const FVector& End, double ServerTime,
+    const AActor* IgnoreActor, FRMCRewindHit& OutHit) const
+{
+    TArray<const FRMCRewindBuffer*, TInlineAllocator<128>> Buffers;
+    Buffers.Reserve(Components.Num());
+    for (const URMCLagCompensationComponent* Component : Components)
+    {
+        Buffers.Add(Component && Component->GetOwner() != IgnoreActor ? &Component->GetBuffer() : nullptr);
+    }
+
+    int32 HitIndex = INDEX_NONE;
+    if (!RewindLineTraceBuffers(Buffers, Start, End, ServerTime, HitIndex, OutHit))
+    {
+        return false;
+    }
+
+    OutHit.Actor = Components[HitIndex]->GetOwner();
+    return true;
+}
+
+bool URMCLagCompensationSubsystem::RewindLineTraceBuffers(TArrayView<const FRMCRewindBuffer* const> Buffers, const FVector& Start,
+    const FVector& End, double ServerTime, int32& OutHitIndex, FRMCRewindHit& OutHit)
+{
+    const FVector Delta = End - Start;
+    const float LengthSq = Delta.SizeSquared();
+
+    OutHitIndex = INDEX_NONE;
+    float BestTime = 2.0f;
+
+    for (int32 Index = 0; Index < Buffers.Num(); ++Index)
+    {
+        const FRMCRewindBuffer* Buffer = Buffers[Index];
+        FRMCRewindSample Pose;
+        if (!Buffer || !Buffer->Sample(ServerTime, Pose))
+        {
+            continue;
+        }
+
+        // Bounding sphere first: distance from the capsule center to the segment
+        const FVector ToCenter = Pose.Location - Start;
+        const float Along = LengthSq > 0.0f ? FMath::Clamp(FVector::DotProduct(ToCenter, Delta) / LengthSq, 0.0f, 1.0f) : 0.0f;
+        if ((ToCenter - Delta * Along).SizeSquared() > FMath::Square(Pose.HalfHeight))
+        {
+            continue;
+        }
+
+        const float Time = IntersectSegmentCapsule(Start, End, Pose.Location, Pose.HalfHeight, Buffer->Radius);
+        if (Time >= 0.0f && Time < BestTime)
+        {
+            BestTime = Time;
+            OutHitIndex = Index;
+            OutHit.Pose = Pose;
+        }
+    }
+
+    if (OutHitIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const FRMCRewindSample& Pose = OutHit.Pose;
+    const float CylinderHalfHeight = FMath::Max(Pose.HalfHeight - Buffers[OutHitIndex]->Radius, 0.0f);
+
+    OutHit.Time = BestTime;
+    OutHit.Location = Start + Delta * BestTime;
+
+    // Away from the nearest point on the capsule's axis
+    const float AxisZ = FMath::Clamp(OutHit.Location.Z - Pose.Location.Z, -CylinderHalfHeight, CylinderHalfHeight);
+    OutHit.Normal = (OutHit.Location - (Pose.Location + FVector(0.0f, 0.0f, AxisZ))).GetSafeNormal();
+    return true;
+}
+
+float URMCLagCompensationSubsystem::IntersectSegmentCapsule(const FVector& Start, const FVector& End, const FVector& Center, float HalfHeight, float Radius)
+{
+    const FVector Delta = End - Start;
+    const FVector Relative = Start - Center;
+    const float CylinderHalfHeight = FMath::Max(HalfHeight - Radius, 0.0f);
+    const float RadiusSq = FMath::Square(Radius);
+
+    // Starting inside
+    const float ClampedZ = FMath::Clamp(Relative.Z, -CylinderHalfHeight, CylinderHalfHeight);
+    if (FVector(Relative.X, Relative.Y, Relative.Z - ClampedZ).SizeSquared() <= RadiusSq)
+    {
+        return 0.0f;
+    }
+
+    // Side of the cylinder. The capsule lies inside the infinite cylinder, so missing that misses everything.
+    const float A = FMath::Square(Delta.X) + FMath::Square(Delta.Y);
+    if (A > SMALL_NUMBER)
+    {
+        const float HalfB = Relative.X * Delta.X + Relative.Y * Delta.Y;
+        const float C = FMath::Square(Relative.X) + FMath::Square(Relative.Y) - RadiusSq;
+        const float Discriminant = HalfB * HalfB - A * C;
+        if (Discriminant < 0.0f)
+        {
+            return -1.0f;
+        }
+
+        const float Time = (-HalfB - FMath::Sqrt(Discriminant)) / A;
+        if (Time >= 0.0f && Time <= 1.0f && FMath::Abs(Relative.Z + Time * Delta.Z) <= CylinderHalfHeight)
+        {
+            return Time;
+        }
+    }
+
+    // Hemispherical caps
+    const float SegmentLengthSq = Delta.SizeSquared();
+    if (SegmentLengthSq <= SMALL_NUMBER)
+    {
+        return -1.0f;
+    }
+
+    float BestTime = -1.0f;
+    for (const float CapZ : { CylinderHalfHeight, -CylinderHalfHeight })
+    {
+        const FVector FromCap(Relative.X, Relative.Y, Relative.Z - CapZ);
+        const float HalfB = FVector::DotProduct(FromCap, Delta);
+        const float C = FromCap.SizeSquared() - RadiusSq;
+        const float Discriminant = HalfB * HalfB - SegmentLengthSq * C;
+        if (Discriminant < 0.0f)
+        {
+            continue;
+        }
+
+        const float Time = (-HalfB - FMath::Sqrt(Discriminant)) / SegmentLengthSq;
+        if (Time >= 0.0f && Time <= 1.0f && (BestTime < 0.0f || Time < BestTime))
+        {
+            BestTime = Time;
+        }
+    }
+
+    return BestTime;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Benchmark
+
+namespace RMCLagCompensationBenchmark
+{
+    static void Run(const TArray<FString>& Args)
+    {
+        const int32 NumCharacters = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+        const int32 NumQueries = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 10000;
+
+        const double SampleInterval = 1.0 / 60.0;
+        const float Speed = 3000.0f;
+        const float ArenaSize = 20000.0f;
+
+        // Characters running straight lines at the speed cap, with a full history
+        FRandomStream Random(1234);
+        TArray<FRMCRewindBuffer> Buffers;
+        Buffers.SetNum(NumCharacters);
+        for (FRMCRewindBuffer& Buffer : Buffers)
+        {
+            Buffer.Radius = 42.0f;
+            const FVector Origin(Random.FRandRange(-ArenaSize, ArenaSize), Random.FRandRange(-ArenaSize, ArenaSize), 0.0f);
+            const FVector Direction = FVector(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), 0.0f).GetSafeNormal();
+            for (int32 Step = 0; Step < FRMCRewindBuffer::Capacity; ++Step)
+            {
+                Buffer.Record(Step * SampleInterval, Origin + Direction * Speed * (Step * SampleInterval), 0.0f, 96.0f,
+                    ERMCPredictedMovementMode::Walking);
+            }
+        }
+
+        TArray<const FRMCRewindBuffer*> BufferPointers;
+        for (const FRMCRewindBuffer& Buffer : Buffers)
+        {
+            BufferPointers.Add(&Buffer);
+        }
+
+        // Shots from random points toward random characters, at random times within the history
+        const double HistorySeconds = (FRMCRewindBuffer::Capacity - 1) * SampleInterval;
+        TArray<FVector> Starts;
+        TArray<FVector> Ends;
+        TArray<double> Times;
+        for (int32 Query = 0; Query < NumQueries; ++Query)
+        {
+            const double Time = Random.FRandRange(0.0f, HistorySeconds);
+            FRMCRewindSample Target;
+            Buffers[Random.RandHelper(NumCharacters)].Sample(Time, Target);
+
+            const FVector Start(Random.FRandRange(-ArenaSize, ArenaSize), Random.FRandRange(-ArenaSize, ArenaSize), 50.0f);
+            Starts.Add(Start);
+            Ends.Add(Start + (Target.Location - Start) * 1.5f);
+            Times.Add(Time);
+        }
+
+        int32 NumHits = 0;
+        const double StartSeconds = FPlatformTime::Seconds();
+        for (int32 Query = 0; Query < NumQueries; ++Query)
+        {
+            int32 HitIndex = INDEX_NONE;
+            FRMCRewindHit Hit;
+            if (URMCLagCompensationSubsystem::RewindLineTraceBuffers(BufferPointers, Starts[Query], Ends[Query], Times[Query], HitIndex, Hit))
+            {
+                ++NumHits;
+            }
+        }
+        const double Seconds = FPlatformTime::Seconds() - StartSeconds;
+
+        UE_LOG(LogTemp, Display, TEXT("RMC lag compensation benchmark: %d characters x %d queries, %d hits"), NumCharacters, NumQueries, NumHits);
+        UE_LOG(LogTemp, Display, TEXT("  %.3f ms total, %.2f us per rewound trace"), Seconds * 1000.0, Seconds * 1e6 / NumQueries);
+    }
+
+    static FAutoConsoleCommand BenchmarkCommand(
+        TEXT("rmc.LagComp.Bench"),
+        TEXT("Times rewound line traces against synthetic character histories. Usage: rmc.LagComp.Bench [Characters=100] [Queries=10000]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
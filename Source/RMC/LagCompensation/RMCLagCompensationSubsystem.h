@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RMCRewindBuffer.h"
+#include "RMCLagCompensationSubsystem.generated.h"
+
+class APlayerController;
+class URMCLagCompensationComponent;
+
+/**
+ * Result of a rewound trace
+ */
+struct RMC_API FRMCRewindHit
+{
+    AActor* Actor = nullptr;
+    FVector Location = FVector::ZeroVector;
+    FVector Normal = FVector::ZeroVector;
+
+    // Fraction of the way from Start to End
+    float Time = 1.0f;
+
+    // Pose the character was rewound to
+    FRMCRewindSample Pose;
+};
+
+/**
+ * Server-side hit validation against characters as they were when the shooter fired. Every
+ * URMCLagCompensationComponent registers here.
+ */
+UCLASS()
+class RMC_API URMCLagCompensationSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    URMCLagCompensationSubsystem();
+
+    void RegisterComponent(URMCLagCompensationComponent* Component);
+
+    void UnregisterComponent(URMCLagCompensationComponent* Component);
+
+    /**
+     * Server time the shooter was looking at: one round trip for the world to reach them and the shot to
+     * come back, plus the proxy smoothing delay. Clamped to MaxRewindSeconds.
+     */
+    double GetShooterViewTime(const APlayerController* Shooter) const;
+
+    /**
+     * Traces against every registered character's capsule as it was at ServerTime. Characters with no
+     * history at ServerTime are skipped. Returns true on a hit.
+     */
+    bool RewindLineTrace(const FVector& Start, const FVector& End, double ServerTime, const AActor* IgnoreActor, FRMCRewindHit& OutHit) const;
+
+    /**
+     * The trace itself, against bare buffers. OutHitIndex is the index into Buffers of the closest hit.
+     * Null buffers are skipped.
+     */
+    static bool RewindLineTraceBuffers(TArrayView<const FRMCRewindBuffer* const> Buffers, const FVector& Start, const FVector& End,
+        double ServerTime, int32& OutHitIndex, FRMCRewindHit& OutHit);
+
+    /**
+     * Segment against an upright capsule. Returns the fraction of the way from Start to End of the first
+     * contact, or a negative value if there is none. A segment starting inside the capsule hits at 0.
+     */
+    static float IntersectSegmentCapsule(const FVector& Start, const FVector& End, const FVector& Center, float HalfHeight, float Radius);
+
+    /** Extra delay between a proxy's replicated and displayed positions, normally its smoothing time */
+    float ProxyViewDelay;
+
+    /** Furthest a shot may be rewound, so a high ping can't reach arbitrarily far back. Also sets how far back characters record. */
+    float MaxRewindSeconds;
+
+private:
+    UPROPERTY()
+    TArray<TObjectPtr<URMCLagCompensationComponent>> Components;
+};
@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCRewindBuffer.h"
+
+void FRMCRewindBuffer::Record(double ServerTime, const FVector& Location, float Yaw, float HalfHeight, ERMCPredictedMovementMode Mode)
+{
+    int32 Index;
+    if (Num >= 2 && ServerTime - Times[ToIndex(Num - 2)] < MinRecordInterval)
+    {
+        // Too soon after the pose before the newest, so move the newest up to now
+        Index = ToIndex(Num - 1);
+    }
+    else if (Num < Capacity)
+    {
+        Index = ToIndex(Num);
+        ++Num;
+    }
+    else
+    {
+        // Full, so overwrite the oldest
+        Index = Head;
+        Head = (Head + 1) & (Capacity - 1);
+    }
+
+    Times[Index] = ServerTime;
+    LocationX[Index] = Location.X;
+    LocationY[Index] = Location.Y;
+    LocationZ[Index] = Location.Z;
+    Yaws[Index] = Yaw;
+    HalfHeights[Index] = HalfHeight;
+    Modes[Index] = Mode;
+}
+
+bool FRMCRewindBuffer::Sample(double ServerTime, FRMCRewindSample& OutSample) const
+{
+    if (Num == 0 || ServerTime < GetOldestTime() || ServerTime > GetNewestTime())
+    {
+        return false;
+    }
+
+    // Newest pose at or before ServerTime, by binary search over age
+    int32 Low = 0;
+    int32 High = Num - 1;
+    if (ServerTime == Times[ToIndex(High)])
+    {
+        Low = High;
+    }
+    else
+    {
+        while (High - Low > 1)
+        {
+            const int32 Mid = (Low + High) / 2;
+            if (Times[ToIndex(Mid)] <= ServerTime)
+            {
+                Low = Mid;
+            }
+            else
+            {
+                High = Mid;
+            }
+        }
+    }
+
+    const int32 From = ToIndex(Low);
+    const int32 To = ToIndex(High);
+    const double Span = Times[To] - Times[From];
+    const float Alpha = Span > 0.0 ? static_cast<float>((ServerTime - Times[From]) / Span) : 0.0f;
+
+    OutSample.ServerTime = ServerTime;
+    OutSample.Location = FVector(
+        FMath::Lerp(LocationX[From], LocationX[To], Alpha),
+        FMath::Lerp(LocationY[From], LocationY[To], Alpha),
+        FMath::Lerp(LocationZ[From], LocationZ[To], Alpha));
+    OutSample.Yaw = FMath::Lerp(Yaws[From], Yaws[From] + FMath::FindDeltaAngleDegrees(Yaws[From], Yaws[To]), Alpha);
+    OutSample.HalfHeight = FMath::Lerp(HalfHeights[From], HalfHeights[To], Alpha);
+    OutSample.Mode = Modes[From];
+    return true;
+}
@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Components/Movement/RMCTrajectoryPrediction.h"
+
+/**
+ * Capsule pose of a character at one point in server time
+ */
+struct RMC_API FRMCRewindSample
+{
+    double ServerTime = 0.0;
+    FVector Location = FVector::ZeroVector;
+    float Yaw = 0.0f;
+    float HalfHeight = 0.0f;
+    ERMCPredictedMovementMode Mode = ERMCPredictedMovementMode::Walking;
+};
+
+/**
+ * Fixed ring of recent capsule poses for one character. Each field has its own array so a rewind only
+ * touches the times while searching and one pair of entries while interpolating. Nothing is allocated
+ * after construction. The capsule is upright, so location, yaw and half height describe it fully.
+ * Poses are kept at least MinRecordInterval apart, so the history spans (Capacity - 2) intervals however
+ * fast the server ticks.
+ */
+struct RMC_API FRMCRewindBuffer
+{
+    static constexpr int32 Capacity = 64;
+
+    /**
+     * Appends a pose, or replaces the newest one if it came less than MinRecordInterval after the pose
+     * before it. Times must not go backwards.
+     */
+    void Record(double ServerTime, const FVector& Location, float Yaw, float HalfHeight, ERMCPredictedMovementMode Mode);
+
+    /**
+     * Pose at ServerTime, interpolated between the two recorded poses around it. Returns false if
+     * ServerTime falls outside the recorded range, rather than passing off the nearest pose as that time.
+     */
+    bool Sample(double ServerTime, FRMCRewindSample& OutSample) const;
+
+    /** Interval that lets the history reach RewindSeconds back */
+    static double GetRecordIntervalFor(float RewindSeconds) { return RewindSeconds / (Capacity - 2); }
+
+    void Reset() { Num = 0; Head = 0; }
+
+    int32 GetNum() const { return Num; }
+
+    /** Server time of the oldest pose still held */
+    double GetOldestTime() const { return Num > 0 ? Times[ToIndex(0)] : 0.0; }
+
+    double GetNewestTime() const { return Num > 0 ? Times[ToIndex(Num - 1)] : 0.0; }
+
+    // Capsule radius, which does not change while moving
+    float Radius = 0.0f;
+
+    // Shortest gap kept between poses. Zero records every one.
+    double MinRecordInterval = 0.0;
+
+private:
+    /** Ring slot of the Age-th oldest pose */
+    int32 ToIndex(int32 Age) const { return (Head + Age) & (Capacity - 1); }
+
+    double Times[Capacity];
+    float LocationX[Capacity];
+    float LocationY[Capacity];
+    float LocationZ[Capacity];
+    float Yaws[Capacity];
+    float HalfHeights[Capacity];
+    ERMCPredictedMovementMode Modes[Capacity];
+
+    // Slot of the oldest pose, and how many are held
+    int32 Head = 0;
+    int32 Num = 0;
+};
+
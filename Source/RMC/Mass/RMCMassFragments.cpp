@@ -0,0 +1,34 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMassFragments.h"
+
+FRMCMovementParams FRMCMassMovementConfigFragment::MakeParams(float GravityZ) const
+{
+    FRMCMovementParams Params;
+
+    Params.WallRunSpeed = Profile.WallRunSpeed;
+    Params.WallRunGravityScale = Profile.WallRunGravityScale;
+    Params.WallRunControlMultiplier = Profile.WallRunControlMultiplier;
+    Params.WallAttractionForce = Profile.WallAttractionForce;
+
+    Params.SlideSpeed = Profile.SlideSpeed;
+    Params.SlideFriction = Profile.SlideFriction;
+    Params.SlideMinSpeed = Profile.SlideMinSpeed;
+    Params.SlideDownhillAccelerationMultiplier = Profile.SlideDownhillAccelerationMultiplier;
+
+    Params.DashDistance = Profile.DashDistance;
+    Params.DashDuration = Profile.DashDuration;
+
+    Params.MaxMomentum = Profile.MaxMomentum;
+    Params.MomentumBuildRate = Profile.MomentumBuildRate;
+    Params.MomentumDecayRate = Profile.MomentumDecayRate;
+
+    Params.GlobalSpeedCap = Profile.GlobalSpeedCap;
+    Params.SpeedCapDamping = Profile.SpeedCapDamping;
+    Params.bApplySpeedCapToZVelocity = Profile.bApplySpeedCapToZVelocity;
+
+    Params.MaxWalkSpeed = MaxWalkSpeed;
+    Params.GravityZ = GravityZ;
+
+    return Params;
+}
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "Math/RandomStream.h"
+#include "../Components/Movement/RMCMovementComponent.h"
+#include "../Components/Movement/RMCMovementSimulation.h"
+#include "RMCMassFragments.generated.h"
+
+class ARMCCharacter;
+
+/**
+ * Movement state of a crowd agent: the simulation core's state plus the timers URMCMovementComponent
+ * keeps in its timer wheel
+ */
+USTRUCT()
+struct RMC_API FRMCMassMovementFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    FRMCMovementSimState State;
+
+    // Seconds left in the current wall run, slide or dash
+    float ModeTimeRemaining = 0.0f;
+
+    float DashCooldownRemaining = 0.0f;
+};
+
+/**
+ * What an agent last learned about its surroundings. Probed a few agents at a time by
+ * URMCMassSceneProbeProcessor rather than every agent every frame.
+ */
+USTRUCT()
+struct RMC_API FRMCMassSceneFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    FVector FloorNormal = FVector::UpVector;
+    FVector WallNormal = FVector::ZeroVector;
+    float FloorZ = 0.0f;
+    float SecondsSinceProbe = 0.0f;
+    bool bHasFloor = false;
+    bool bHasWall = false;
+};
+
+/**
+ * Randomized traversal for ambient agents: wander, and slide, dash, jump or wall run now and then
+ */
+USTRUCT()
+struct RMC_API FRMCMassTraversalFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    FRandomStream Random;
+    FVector Heading = FVector::ForwardVector;
+    float TurnTimer = 0.0f;
+    float ActionTimer = 0.0f;
+};
+
+/**
+ * Tuning shared by every agent built from the same trait settings
+ */
+USTRUCT()
+struct RMC_API FRMCMassMovementConfigFragment : public FMassConstSharedFragment
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FMovementPhysicsProfile Profile;
+
+    UPROPERTY()
+    float MaxWalkSpeed = 600.0f;
+
+    UPROPERTY()
+    float MaxAcceleration = 2048.0f;
+
+    UPROPERTY()
+    float JumpZVelocity = 600.0f;
+
+    UPROPERTY()
+    float CapsuleHalfHeight = 96.0f;
+
+    UPROPERTY()
+    float CapsuleRadius = 42.0f;
+
+    // Characters agents turn into near players, and how near
+    UPROPERTY()
+    TSubclassOf<ARMCCharacter> CharacterClass;
+
+    UPROPERTY()
+    float PromotionDistance = 2000.0f;
+
+    /** The profile as the simulation core's parameters */
+    FRMCMovementParams MakeParams(float GravityZ) const;
+};
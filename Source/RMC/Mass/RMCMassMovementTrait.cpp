@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMassMovementTrait.h"
+#include "RMCMassFragments.h"
+#include "../RMCCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "MassCommonFragments.h"
+#include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
+
+void URMCMassMovementTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+    BuildContext.AddFragment<FTransformFragment>();
+    BuildContext.AddFragment<FRMCMassMovementFragment>();
+    BuildContext.AddFragment<FRMCMassSceneFragment>();
+    BuildContext.AddFragment<FRMCMassTraversalFragment>();
+
+    // Tuning comes from the character the agents stand in for
+    FRMCMassMovementConfigFragment Config;
+    Config.CharacterClass = CharacterClass;
+    Config.PromotionDistance = PromotionDistance;
+
+    const ARMCCharacter* DefaultCharacter = CharacterClass ? CharacterClass->GetDefaultObject<ARMCCharacter>() : GetDefault<ARMCCharacter>();
+    if (const URMCMovementComponent* MovementComponent = DefaultCharacter->GetRMCMovementComponent())
+    {
+        const FMovementPhysicsProfile* Profile = PhysicsProfileName != NAME_None ? MovementComponent->FindPhysicsProfile(PhysicsProfileName) : nullptr;
+        if (PhysicsProfileName != NAME_None && !Profile)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("%s: %s has no physics profile %s, using its defaults"), *GetName(), *GetNameSafe(CharacterClass),
+                *PhysicsProfileName.ToString());
+        }
+
+        Config.Profile = Profile ? *Profile : MovementComponent->MakeCurrentPhysicsProfile();
+        Config.MaxWalkSpeed = MovementComponent->MaxWalkSpeed;
+        Config.MaxAcceleration = MovementComponent->MaxAcceleration;
+        Config.JumpZVelocity = MovementComponent->JumpZVelocity;
+    }
+
+    if (const UCapsuleComponent* Capsule = DefaultCharacter->GetCapsuleComponent())
+    {
+        Config.CapsuleHalfHeight = Capsule->GetUnscaledCapsuleHalfHeight();
+        Config.CapsuleRadius = Capsule->GetUnscaledCapsuleRadius();
+    }
+
+    FMassEntityManager& EntityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+    BuildContext.AddConstSharedFragment(EntityManager.GetOrCreateConstSharedFragment(Config));
+}
@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTraitBase.h"
+#include "RMCMassMovementTrait.generated.h"
+
+class ARMCCharacter;
+
+/**
+ * Makes a Mass entity a lightweight RMC mover: it wall runs, slides, dashes and builds momentum by the
+ * same rules as URMCMovementComponent, and turns into a full CharacterClass near a player. Add it to an
+ * entity config alongside a visualization trait, and spawn with a Mass spawner.
+ */
+UCLASS(meta = (DisplayName = "RMC Movement"))
+class RMC_API URMCMassMovementTrait : public UMassEntityTraitBase
+{
+    GENERATED_BODY()
+
+public:
+    /** Source of the agents' tuning, and what they are promoted to */
+    UPROPERTY(EditAnywhere, Category = "RMC")
+    TSubclassOf<ARMCCharacter> CharacterClass;
+
+    /** Profile from CharacterClass's movement component. None uses the component's own values. */
+    UPROPERTY(EditAnywhere, Category = "RMC")
+    FName PhysicsProfileName;
+
+    /** Distance to a player's pawn at which an agent becomes a full character. 0 never promotes. */
+    UPROPERTY(EditAnywhere, Category = "RMC", meta = (ClampMin = "0.0"))
+    float PromotionDistance = 2000.0f;
+
+protected:
+    virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+};
@@ -0,0 +1,580 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMassProcessors.h"
+#include "RMCMassFragments.h"
+#include "../RMCCharacter.h"
+#include "../Pooling/RMCCharacterPoolSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "MassCommonFragments.h"
+#include "MassCommonTypes.h"
+#include "MassExecutionContext.h"
+
+namespace RMCMassMovement
+{
+    // UCharacterMovementComponent's default MaxStepHeight: walking agents follow drops up to this
+    static constexpr float GroundSnapDistance = 45.0f;
+
+    // Agents per mode after the last movement pass, and promotions so far, for rmc.Mass.Stats
+    static int32 ModeCounts[5] = {};
+    static int32 NumPromoted = 0;
+
+    /** Answers the simulation core's scene queries from the agents' last probes */
+    class FSceneQuery : public IRMCMovementSceneQuery
+    {
+    public:
+        FSceneQuery(TConstArrayView<FRMCMassSceneFragment> InScenes, TConstArrayView<FTransformFragment> InTransforms, float InHalfHeight)
+            : Scenes(InScenes)
+            , Transforms(InTransforms)
+            , HalfHeight(InHalfHeight)
+        {
+        }
+
+        virtual bool FindWall(int32 AgentIndex, const FRMCMovementSimState& State, FVector& OutWallNormal) const override
+        {
+            OutWallNormal = Scenes[AgentIndex].WallNormal;
+            return Scenes[AgentIndex].bHasWall;
+        }
+
+        virtual FVector GetFloorNormal(int32 AgentIndex, const FRMCMovementSimState& State) const override
+        {
+            return Scenes[AgentIndex].FloorNormal;
+        }
+
+        virtual bool IsMovingOnGround(int32 AgentIndex, const FRMCMovementSimState& State) const override
+        {
+            if (State.Mode == ERMCMovementSimMode::Falling || State.Mode == ERMCMovementSimMode::WallRunning || !Scenes[AgentIndex].bHasFloor)
+            {
+                return false;
+            }
+
+            return GetHeightAboveFloor(AgentIndex) <= GroundSnapDistance;
+        }
+
+        /** Gap between the bottom of the agent's capsule and its floor */
+        float GetHeightAboveFloor(int32 AgentIndex) const
+        {
+            return Transforms[AgentIndex].GetTransform().GetLocation().Z - HalfHeight - Scenes[AgentIndex].FloorZ;
+        }
+
+    private:
+        TConstArrayView<FRMCMassSceneFragment> Scenes;
+        TConstArrayView<FTransformFragment> Transforms;
+        float HalfHeight;
+    };
+
+    /** Wanders, turning now and then and away from walls in the way */
+    static void UpdateHeading(FRMCMassTraversalFragment& Traversal, const FRMCMassSceneFragment& Scene, float DeltaTime)
+    {
+        Traversal.TurnTimer -= DeltaTime;
+        if (Traversal.TurnTimer <= 0.0f)
+        {
+            Traversal.Heading = Traversal.Heading.RotateAngleAxis(Traversal.Random.FRandRange(-60.0f, 60.0f), FVector::UpVector);
+            Traversal.TurnTimer = Traversal.Random.FRandRange(1.0f, 4.0f);
+        }
+
+        if (Scene.bHasWall && FVector::DotProduct(Traversal.Heading, Scene.WallNormal) < 0.0f)
+        {
+            Traversal.Heading = Traversal.Heading.MirrorByVector(Scene.WallNormal).GetSafeNormal2D();
+        }
+    }
+
+    /** Ends a timed mode the way URMCMovementComponent's EndWallRun, EndSlide and EndDash do */
+    static void EndTimedMode(FRMCMassMovementFragment& Movement, FRMCMassSceneFragment& Scene, const FRMCMassMovementConfigFragment& Config,
+        const FRMCMovementParams& Params, bool bOnGround)
+    {
+        FRMCMovementSimState& State = Movement.State;
+        switch (State.Mode)
+        {
+        case ERMCMovementSimMode::WallRunning:
+        {
+            // Agents always kick off at the end of a wall run, as WallRunJump does
+            const FVector JumpDirection = (State.WallNormal + FVector(0, 0, 0.5f)).GetSafeNormal();
+            State.Velocity = JumpDirection * Config.Profile.WallRunJumpOffForce;
+            State.Velocity.Z = Config.JumpZVelocity;
+            State.Momentum = FRMCMovementSimulation::ApplyMomentumDelta(Params, State.Momentum, 15.0f);
+            State.WallNormal = FVector::ZeroVector;
+            State.Mode = ERMCMovementSimMode::Falling;
+
+            // Forget the wall until the next probe, or the agent would grab it again straight away
+            Scene.bHasWall = false;
+            break;
+        }
+
+        case ERMCMovementSimMode::Dashing:
+            State.Velocity += State.DashDirection * (bOnGround ? Config.Profile.DashGroundSpeedBoost : Config.Profile.DashAirSpeedBoost);
+            State.Mode = bOnGround ? ERMCMovementSimMode::Walking : ERMCMovementSimMode::Falling;
+            break;
+
+        case ERMCMovementSimMode::Sliding:
+            State.Mode = bOnGround ? ERMCMovementSimMode::Walking : ERMCMovementSimMode::Falling;
+            break;
+
+        default:
+            break;
+        }
+
+        Movement.ModeTimeRemaining = 0.0f;
+    }
+
+    /** Picks the agent's next slide, dash, jump or wall run, under the same conditions as URMCMovementComponent's Can* checks */
+    static void StartActions(FRMCMassMovementFragment& Movement, FRMCMassTraversalFragment& Traversal, const FRMCMassSceneFragment& Scene,
+        const FRMCMassMovementConfigFragment& Config, const FRMCMovementParams& Params, bool bOnGround, float HeightAboveFloor, float DeltaTime)
+    {
+        FRMCMovementSimState& State = Movement.State;
+        const FMovementPhysicsProfile& Profile = Config.Profile;
+
+        if (State.Mode == ERMCMovementSimMode::Falling)
+        {
+            const bool bHighEnough = !Scene.bHasFloor || HeightAboveFloor >= Profile.MinWallRunHeight;
+            if (Scene.bHasWall && bHighEnough && State.Velocity.SizeSquared() >= 10000.0f && State.Momentum >= Profile.MaxMomentum * 0.2f)
+            {
+                FVector WallRunDirection = FVector::CrossProduct(Scene.WallNormal, FVector(0, 0, 1)).GetSafeNormal();
+                if (FVector::DotProduct(State.Velocity, WallRunDirection) < 0.0f)
+                {
+                    WallRunDirection = -WallRunDirection;
+                }
+
+                State.Mode = ERMCMovementSimMode::WallRunning;
+                State.WallNormal = Scene.WallNormal;
+                State.Velocity = WallRunDirection * FMath::Max(State.Velocity.Size2D(), Profile.WallRunSpeed);
+                State.Momentum = FRMCMovementSimulation::ApplyMomentumDelta(Params, State.Momentum, 10.0f);
+                Movement.ModeTimeRemaining = Profile.MaxWallRunTime;
+            }
+            return;
+        }
+
+        Traversal.ActionTimer -= DeltaTime;
+        if (State.Mode != ERMCMovementSimMode::Walking || !bOnGround || Traversal.ActionTimer > 0.0f)
+        {
+            return;
+        }
+        Traversal.ActionTimer = Traversal.Random.FRandRange(1.5f, 4.0f);
+
+        const float Roll = Traversal.Random.FRand();
+        if (Roll < 0.35f && State.Velocity.SizeSquared() >= FMath::Square(Profile.SlideMinSpeed) && State.Momentum >= Profile.MaxMomentum * 0.1f)
+        {
+            State.Mode = ERMCMovementSimMode::Sliding;
+            State.Velocity = State.Velocity.GetSafeNormal2D() * Profile.SlideSpeed;
+            State.Momentum = FRMCMovementSimulation::ApplyMomentumDelta(Params, State.Momentum, 5.0f);
+            Movement.ModeTimeRemaining = Profile.SlideMaxDuration;
+        }
+        else if (Roll < 0.6f && Movement.DashCooldownRemaining <= 0.0f && State.Momentum >= Profile.MaxMomentum * 0.3f)
+        {
+            State.Mode = ERMCMovementSimMode::Dashing;
+            State.DashDirection = Traversal.Heading;
+            State.Velocity = FRMCMovementSimulation::ApplyDashForces(Params, State.DashDirection);
+            State.Momentum = FRMCMovementSimulation::ApplyMomentumDelta(Params, State.Momentum, 20.0f);
+            Movement.ModeTimeRemaining = Profile.DashDuration;
+            Movement.DashCooldownRemaining = Profile.DashCooldown;
+        }
+        else
+        {
+            State.Mode = ERMCMovementSimMode::Falling;
+            State.Velocity.Z = Config.JumpZVelocity;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Initializer
+
+URMCMassAgentInitializer::URMCMassAgentInitializer()
+    : EntityQuery(*this)
+{
+    ObservedType = FRMCMassTraversalFragment::StaticStruct();
+    Operation = EMassObservedOperation::Add;
+}
+
+void URMCMassAgentInitializer::ConfigureQueries()
+{
+    EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FRMCMassMovementFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddRequirement<FRMCMassSceneFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddRequirement<FRMCMassTraversalFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddConstSharedRequirement<FRMCMassMovementConfigFragment>();
+}
+
+void URMCMassAgentInitializer::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+    EntityQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& Context)
+    {
+        const TConstArrayView<FTransformFragment> Transforms = Context.GetFragmentView<FTransformFragment>();
+        const TArrayView<FRMCMassMovementFragment> Movements = Context.GetMutableFragmentView<FRMCMassMovementFragment>();
+        const TArrayView<FRMCMassSceneFragment> Scenes = Context.GetMutableFragmentView<FRMCMassSceneFragment>();
+        const TArrayView<FRMCMassTraversalFragment> Traversals = Context.GetMutableFragmentView<FRMCMassTraversalFragment>();
+        const FRMCMassMovementConfigFragment& Config = Context.GetConstSharedFragment<FRMCMassMovementConfigFragment>();
+
+        for (int32 Index = 0; Index < Context.GetNumEntities(); ++Index)
+        {
+            FRMCMassTraversalFragment& Traversal = Traversals[Index];
+            Traversal.Random.Initialize(Context.GetEntity(Index).Index);
+            Traversal.Heading = Transforms[Index].GetTransform().GetRotation().GetForwardVector().GetSafeNormal2D();
+            if (Traversal.Heading.IsNearlyZero())
+            {
+                Traversal.Heading = FVector::ForwardVector;
+            }
+            Traversal.TurnTimer = Traversal.Random.FRandRange(1.0f, 4.0f);
+            Traversal.ActionTimer = Traversal.Random.FRandRange(0.5f, 4.0f);
+
+            // Start with enough momentum for every action, as a character that has been moving would have
+            Movements[Index].State.Momentum = Config.Profile.MaxMomentum * 0.5f;
+            Movements[Index].State.Mode = ERMCMovementSimMode::Falling;
+
+            // Probe on the first pass, then at a random phase so agents spawned together don't all probe on the same frame
+            Scenes[Index].SecondsSinceProbe = URMCMassSceneProbeProcessor::ProbeInterval * (1.0f + Traversal.Random.FRand());
+        }
+    });
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Scene probe
+
+URMCMassSceneProbeProcessor::URMCMassSceneProbeProcessor()
+    : EntityQuery(*this)
+{
+    ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Movement;
+    ExecutionOrder.ExecuteBefore.Add(URMCMassMovementProcessor::StaticClass()->GetFName());
+    bRequiresGameThreadExecution = true;
+}
+
+void URMCMassSceneProbeProcessor::ConfigureQueries()
+{
+    EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FRMCMassMovementFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FRMCMassSceneFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddConstSharedRequirement<FRMCMassMovementConfigFragment>();
+}
+
+void URMCMassSceneProbeProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+    const UWorld* World = EntityManager.GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    EntityQuery.ForEachEntityChunk(EntityManager, Context, [World](FMassExecutionContext& Context)
+    {
+        const TConstArrayView<FTransformFragment> Transforms = Context.GetFragmentView<FTransformFragment>();
+        const TConstArrayView<FRMCMassMovementFragment> Movements = Context.GetFragmentView<FRMCMassMovementFragment>();
+        const TArrayView<FRMCMassSceneFragment> Scenes = Context.GetMutableFragmentView<FRMCMassSceneFragment>();
+        const FRMCMassMovementConfigFragment& Config = Context.GetConstSharedFragment<FRMCMassMovementConfigFragment>();
+        const float DeltaTime = Context.GetDeltaTimeSeconds();
+
+        const float MaxWallZ = FMath::Sin(FMath::DegreesToRadians(Config.Profile.MaxWallRunSurfaceAngle));
+        const float WallTraceDistance = Config.CapsuleRadius + 20.0f;
+        const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(RMCMassSceneProbe));
+
+        for (int32 Index = 0; Index < Context.GetNumEntities(); ++Index)
+        {
+            FRMCMassSceneFragment& Scene = Scenes[Index];
+            Scene.SecondsSinceProbe += DeltaTime;
+            if (Scene.SecondsSinceProbe < ProbeInterval)
+            {
+                continue;
+            }
+            Scene.SecondsSinceProbe = FMath::Fmod(Scene.SecondsSinceProbe, ProbeInterval);
+
+            const FRMCMovementSimState& State = Movements[Index].State;
+            const FVector Location = Transforms[Index].GetTransform().GetLocation();
+
+            // Far enough down to keep the floor while jumping, and to see whether a wall run is high enough
+            FHitResult FloorHit;
+            const FVector FloorEnd = Location - FVector(0, 0, Config.CapsuleHalfHeight + Config.Profile.MinWallRunHeight + 500.0f);
+            Scene.bHasFloor = World->LineTraceSingleByChannel(FloorHit, Location, FloorEnd, ECC_Visibility, QueryParams);
+            if (Scene.bHasFloor)
+            {
+                Scene.FloorNormal = FloorHit.ImpactNormal;
+                Scene.FloorZ = FloorHit.ImpactPoint.Z;
+            }
+
+            // The wall being run on first, otherwise ahead and to either side, as at reduced movement LOD
+            FVector Ahead = State.Velocity.GetSafeNormal2D();
+            if (Ahead.IsNearlyZero())
+            {
+                Ahead = Transforms[Index].GetTransform().GetRotation().GetForwardVector().GetSafeNormal2D();
+            }
+            const FVector Right = FVector::CrossProduct(Ahead, FVector::UpVector);
+            const FVector Directions[] = { State.Mode == ERMCMovementSimMode::WallRunning ? -State.WallNormal : Ahead, Right, -Right };
+
+            Scene.bHasWall = false;
+            for (const FVector& Direction : Directions)
+            {
+                FHitResult WallHit;
+                if (World->LineTraceSingleByChannel(WallHit, Location, Location + Direction * WallTraceDistance, ECC_Visibility, QueryParams)
+                    && FMath::Abs(WallHit.ImpactNormal.Z) <= MaxWallZ)
+                {
+                    Scene.bHasWall = true;
+                    Scene.WallNormal = WallHit.ImpactNormal;
+                    break;
+                }
+            }
+        }
+    });
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Movement
+
+URMCMassMovementProcessor::URMCMassMovementProcessor()
+    : EntityQuery(*this)
+{
+    ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Movement;
+}
+
+void URMCMassMovementProcessor::ConfigureQueries()
+{
+    EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddRequirement<FRMCMassMovementFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddRequirement<FRMCMassSceneFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddRequirement<FRMCMassTraversalFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddConstSharedRequirement<FRMCMassMovementConfigFragment>();
+}
+
+void URMCMassMovementProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+    using namespace RMCMassMovement;
+
+    const UWorld* World = EntityManager.GetWorld();
+    const float GravityZ = World ? World->GetGravityZ() : -980.0f;
+
+    int32 Counts[UE_ARRAY_COUNT(ModeCounts)] = {};
+
+    EntityQuery.ForEachEntityChunk(EntityManager, Context, [GravityZ, &Counts](FMassExecutionContext& Context)
+    {
+        const TArrayView<FTransformFragment> Transforms = Context.GetMutableFragmentView<FTransformFragment>();
+        const TArrayView<FRMCMassMovementFragment> Movements = Context.GetMutableFragmentView<FRMCMassMovementFragment>();
+        const TArrayView<FRMCMassSceneFragment> Scenes = Context.GetMutableFragmentView<FRMCMassSceneFragment>();
+        const TArrayView<FRMCMassTraversalFragment> Traversals = Context.GetMutableFragmentView<FRMCMassTraversalFragment>();
+        const FRMCMassMovementConfigFragment& Config = Context.GetConstSharedFragment<FRMCMassMovementConfigFragment>();
+        const float DeltaTime = Context.GetDeltaTimeSeconds();
+
+        const FRMCMovementParams Params = Config.MakeParams(GravityZ);
+        const FSceneQuery SceneQuery(Scenes, Transforms, Config.CapsuleHalfHeight);
+
+        for (int32 Index = 0; Index < Context.GetNumEntities(); ++Index)
+        {
+            FRMCMassMovementFragment& Movement = Movements[Index];
+            FRMCMassSceneFragment& Scene = Scenes[Index];
+            FRMCMassTraversalFragment& Traversal = Traversals[Index];
+            FRMCMovementSimState& State = Movement.State;
+
+            // Timers, as the component's timer wheel advances them
+            Movement.DashCooldownRemaining = FMath::Max(Movement.DashCooldownRemaining - DeltaTime, 0.0f);
+            if (Movement.ModeTimeRemaining > 0.0f)
+            {
+                Movement.ModeTimeRemaining -= DeltaTime;
+                if (Movement.ModeTimeRemaining <= 0.0f)
+                {
+                    EndTimedMode(Movement, Scene, Config, Params, SceneQuery.IsMovingOnGround(Index, State));
+                }
+            }
+
+            UpdateHeading(Traversal, Scene, DeltaTime);
+            StartActions(Movement, Traversal, Scene, Config, Params, SceneQuery.IsMovingOnGround(Index, State),
+                SceneQuery.GetHeightAboveFloor(Index), DeltaTime);
+
+            // Walking and falling are the base character movement's job; an agent walks toward its heading and falls under gravity
+            if (State.Mode == ERMCMovementSimMode::Walking)
+            {
+                const FVector Horizontal = FMath::VInterpConstantTo(FVector(State.Velocity.X, State.Velocity.Y, 0.0f),
+                    Traversal.Heading * Config.MaxWalkSpeed, DeltaTime, Config.MaxAcceleration);
+                State.Velocity = FVector(Horizontal.X, Horizontal.Y, 0.0f);
+            }
+            else if (State.Mode == ERMCMovementSimMode::Falling)
+            {
+                State.Velocity.Z += GravityZ * DeltaTime;
+            }
+
+            FRMCMovementSimInput Input;
+            Input.MoveInput = Traversal.Heading;
+            Input.DeltaTime = DeltaTime;
+
+            const ERMCMovementSimMode PreviousMode = State.Mode;
+            State = FRMCMovementSimulation::Step(State, Input, Params, SceneQuery, Index);
+            if (State.Mode != PreviousMode)
+            {
+                // The rules ended the wall run or slide early
+                Movement.ModeTimeRemaining = 0.0f;
+            }
+
+            // Walking into a wall stops at it
+            if (State.Mode == ERMCMovementSimMode::Walking && Scene.bHasWall && FVector::DotProduct(State.Velocity, Scene.WallNormal) < 0.0f)
+            {
+                State.Velocity = FVector::VectorPlaneProject(State.Velocity, Scene.WallNormal);
+            }
+
+            FTransform& Transform = Transforms[Index].GetMutableTransform();
+            const FVector OldLocation = Transform.GetLocation();
+            FVector Location = OldLocation + State.Velocity * DeltaTime;
+
+            if (Scene.bHasFloor)
+            {
+                // Follow the probed slope until the next probe
+                const FVector& FloorNormal = Scene.FloorNormal;
+                if (FloorNormal.Z > UE_KINDA_SMALL_NUMBER)
+                {
+                    const FVector Moved = Location - OldLocation;
+                    Scene.FloorZ -= (FloorNormal.X * Moved.X + FloorNormal.Y * Moved.Y) / FloorNormal.Z;
+                }
+
+                const float StandingZ = Scene.FloorZ + Config.CapsuleHalfHeight;
+                const bool bGrounded = State.Mode == ERMCMovementSimMode::Walking || State.Mode == ERMCMovementSimMode::Sliding;
+                if (Location.Z <= StandingZ || (bGrounded && Location.Z - StandingZ <= GroundSnapDistance))
+                {
+                    Location.Z = StandingZ;
+                    State.Velocity.Z = 0.0f;
+
+                    if (State.Mode == ERMCMovementSimMode::Falling || State.Mode == ERMCMovementSimMode::WallRunning)
+                    {
+                        State.Mode = ERMCMovementSimMode::Walking;
+                        State.WallNormal = FVector::ZeroVector;
+                        Movement.ModeTimeRemaining = 0.0f;
+                    }
+                }
+                else if (bGrounded)
+                {
+                    // Walked off a ledge
+                    State.Mode = ERMCMovementSimMode::Falling;
+                    Movement.ModeTimeRemaining = 0.0f;
+                }
+            }
+            else if (State.Mode == ERMCMovementSimMode::Walking || State.Mode == ERMCMovementSimMode::Sliding)
+            {
+                State.Mode = ERMCMovementSimMode::Falling;
+                Movement.ModeTimeRemaining = 0.0f;
+            }
+
+            Transform.SetLocation(Location);
+            if (!State.Velocity.IsNearlyZero(1.0f))
+            {
+                Transform.SetRotation(FRotator(0.0f, State.Velocity.Rotation().Yaw, 0.0f).Quaternion());
+            }
+
+            ++Counts[static_cast<int32>(State.Mode)];
+        }
+    });
+
+    FMemory::Memcpy(ModeCounts, Counts, sizeof(ModeCounts));
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Promotion
+
+URMCMassPromotionProcessor::URMCMassPromotionProcessor()
+    : EntityQuery(*this)
+{
+    ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+    ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Movement;
+    ExecutionOrder.ExecuteAfter.Add(URMCMassMovementProcessor::StaticClass()->GetFName());
+    bRequiresGameThreadExecution = true;
+}
+
+void URMCMassPromotionProcessor::ConfigureQueries()
+{
+    EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FRMCMassMovementFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddConstSharedRequirement<FRMCMassMovementConfigFragment>();
+}
+
+void URMCMassPromotionProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+    UWorld* World = EntityManager.GetWorld();
+    URMCCharacterPoolSubsystem* Pool = World ? World->GetSubsystem<URMCCharacterPoolSubsystem>() : nullptr;
+    if (!Pool)
+    {
+        return;
+    }
+
+    TArray<FVector, TInlineAllocator<16>> PawnLocations;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APawn* Pawn = It->Get() ? It->Get()->GetPawn() : nullptr)
+        {
+            PawnLocations.Add(Pawn->GetActorLocation());
+        }
+    }
+
+    if (PawnLocations.Num() == 0)
+    {
+        return;
+    }
+
+    int32 PromotionsLeft = MaxPromotionsPerFrame;
+    EntityQuery.ForEachEntityChunk(EntityManager, Context, [Pool, &PawnLocations, &PromotionsLeft](FMassExecutionContext& Context)
+    {
+        const FRMCMassMovementConfigFragment& Config = Context.GetConstSharedFragment<FRMCMassMovementConfigFragment>();
+        if (!Config.CharacterClass || Config.PromotionDistance <= 0.0f || PromotionsLeft <= 0)
+        {
+            return;
+        }
+
+        const TConstArrayView<FTransformFragment> Transforms = Context.GetFragmentView<FTransformFragment>();
+        const TConstArrayView<FRMCMassMovementFragment> Movements = Context.GetFragmentView<FRMCMassMovementFragment>();
+        const float PromotionDistanceSquared = FMath::Square(Config.PromotionDistance);
+
+        for (int32 Index = 0; Index < Context.GetNumEntities() && PromotionsLeft > 0; ++Index)
+        {
+            const FTransform& Transform = Transforms[Index].GetTransform();
+            const bool bNearPlayer = PawnLocations.ContainsByPredicate([&Transform, PromotionDistanceSquared](const FVector& PawnLocation)
+            {
+                return FVector::DistSquared(PawnLocation, Transform.GetLocation()) < PromotionDistanceSquared;
+            });
+
+            if (!bNearPlayer)
+            {
+                continue;
+            }
+
+            ARMCCharacter* Character = Pool->Acquire(Config.CharacterClass, Transform);
+            if (!Character)
+            {
+                continue;
+            }
+
+            if (!Character->GetController())
+            {
+                Character->SpawnDefaultController();
+            }
+
+            // Timed modes aren't carried over; the character picks up from plain walking or falling with the agent's speed
+            if (URMCMovementComponent* MovementComponent = Character->GetRMCMovementComponent())
+            {
+                const FRMCMovementSimState& State = Movements[Index].State;
+                if (Config.Profile.ProfileName != NAME_None)
+                {
+                    MovementComponent->SetMovementPhysicsProfile(Config.Profile.ProfileName);
+                }
+
+                const bool bGrounded = State.Mode == ERMCMovementSimMode::Walking || State.Mode == ERMCMovementSimMode::Sliding;
+                MovementComponent->SetMovementMode(bGrounded ? MOVE_Walking : MOVE_Falling);
+                MovementComponent->Velocity = State.Velocity;
+                MovementComponent->CurrentMomentum = State.Momentum;
+            }
+
+            Context.Defer().DestroyEntity(Context.GetEntity(Index));
+            --PromotionsLeft;
+            ++RMCMassMovement::NumPromoted;
+        }
+    });
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Console commands
+
+namespace RMCMassCommands
+{
+    static FAutoConsoleCommandWithWorldAndArgs StatsCommand(
+        TEXT("rmc.Mass.Stats"),
+        TEXT("Logs how many RMC crowd agents are in each movement mode, and how many have been promoted to characters"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            using namespace RMCMassMovement;
+
+            UE_LOG(LogTemp, Display, TEXT("RMC crowd agents: %d walking, %d falling, %d wall running, %d sliding, %d dashing; %d promoted"),
+                ModeCounts[0], ModeCounts[1], ModeCounts[2], ModeCounts[3], ModeCounts[4], NumPromoted);
+        }));
+}
@@ -0,0 +1,91 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassObserverProcessor.h"
+#include "MassProcessor.h"
+#include "RMCMassProcessors.generated.h"
+
+/**
+ * Seeds a new agent's traversal and starting momentum
+ */
+UCLASS()
+class RMC_API URMCMassAgentInitializer : public UMassObserverProcessor
+{
+    GENERATED_BODY()
+
+public:
+    URMCMassAgentInitializer();
+
+protected:
+    virtual void ConfigureQueries() override;
+    virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+    FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Traces the floor and nearby walls for each agent. An agent is probed once every ProbeInterval,
+ * and agents are spread across frames, so the traces per frame stay flat as the crowd grows.
+ */
+UCLASS()
+class RMC_API URMCMassSceneProbeProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    URMCMassSceneProbeProcessor();
+
+    /** Seconds between probes of the same agent */
+    static constexpr float ProbeInterval = 0.25f;
+
+protected:
+    virtual void ConfigureQueries() override;
+    virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+    FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Moves agents by the RMC rules: picks traversal actions, enters and times out modes, then runs
+ * FRMCMovementSimulation::Step against the last probe and integrates. Needs no world access, so it
+ * runs off the game thread.
+ */
+UCLASS()
+class RMC_API URMCMassMovementProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    URMCMassMovementProcessor();
+
+protected:
+    virtual void ConfigureQueries() override;
+    virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+    FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Turns agents near a player's pawn into full RMC characters that keep the agent's velocity,
+ * momentum and profile, and removes the agent. Characters come from URMCCharacterPoolSubsystem,
+ * so prewarming the pool keeps promotions from hitching.
+ */
+UCLASS()
+class RMC_API URMCMassPromotionProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    URMCMassPromotionProcessor();
+
+    /** Most agents promoted in one frame; the rest wait for the next */
+    static constexpr int32 MaxPromotionsPerFrame = 4;
+
+protected:
+    virtual void ConfigureQueries() override;
+    virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+    FMassEntityQuery EntityQuery;
+};
@@ -0,0 +1,173 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMoverCharacter.h"
+#include "RMCMoverComponent.h"
+#include "RMCMoverTypes.h"
+#include "Camera/CameraComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/InputComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/SpringArmComponent.h"
+
+ARMCMoverCharacter::ARMCMoverCharacter(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    // Same collision capsule as ARMCCharacter
+    CapsuleComponent = CreateDefaultSubobject<UCapsuleComponent>(TEXT("CollisionCylinder"));
+    CapsuleComponent->InitCapsuleSize(42.f, 96.0f);
+    CapsuleComponent->SetCollisionProfileName(UCollisionProfile::Pawn_ProfileName);
+    RootComponent = CapsuleComponent;
+
+    Mesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("CharacterMesh0"));
+    Mesh->SetupAttachment(CapsuleComponent);
+    Mesh->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+
+    CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
+    CameraBoom->SetupAttachment(RootComponent);
+    CameraBoom->TargetArmLength = 300.0f;
+    CameraBoom->bUsePawnControlRotation = true;
+
+    FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
+    FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
+    FollowCamera->bUsePawnControlRotation = false;
+
+    MoverComponent = CreateDefaultSubobject<URMCMoverComponent>(TEXT("MoverComponent"));
+
+    BaseTurnRate = 45.f;
+    BaseLookUpRate = 45.f;
+
+    bUseControllerRotationPitch = false;
+    bUseControllerRotationYaw = false;
+    bUseControllerRotationRoll = false;
+
+    // Mover replicates through Network Prediction, not actor movement replication
+    bReplicates = true;
+    SetReplicatingMovement(false);
+
+    ForwardInputValue = 0.0f;
+    RightInputValue = 0.0f;
+    bIsJumpPressed = false;
+    bIsJumpJustPressed = false;
+    bIsSlidePressed = false;
+    bIsSlideJustPressed = false;
+    bIsDashJustPressed = false;
+}
+
+void ARMCMoverCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
+{
+    Super::SetupPlayerInputComponent(PlayerInputComponent);
+
+    PlayerInputComponent->BindAxis("MoveForward", this, &ARMCMoverCharacter::MoveForward);
+    PlayerInputComponent->BindAxis("MoveRight", this, &ARMCMoverCharacter::MoveRight);
+    PlayerInputComponent->BindAxis("Turn", this, &ARMCMoverCharacter::Turn);
+    PlayerInputComponent->BindAxis("LookUp", this, &ARMCMoverCharacter::LookUp);
+    PlayerInputComponent->BindAxis("TurnRate", this, &ARMCMoverCharacter::TurnAtRate);
+    PlayerInputComponent->BindAxis("LookUpRate", this, &ARMCMoverCharacter::LookUpAtRate);
+
+    PlayerInputComponent->BindAction("Jump", IE_Pressed, this, &ARMCMoverCharacter::OnJumpPressed);
+    PlayerInputComponent->BindAction("Jump", IE_Released, this, &ARMCMoverCharacter::OnJumpReleased);
+    PlayerInputComponent->BindAction("Dash", IE_Pressed, this, &ARMCMoverCharacter::OnDashPressed);
+    PlayerInputComponent->BindAction("Slide", IE_Pressed, this, &ARMCMoverCharacter::OnSlidePressed);
+    PlayerInputComponent->BindAction("Slide", IE_Released, this, &ARMCMoverCharacter::OnSlideReleased);
+}
+
+void ARMCMoverCharacter::ProduceInput_Implementation(int32 SimTimeMs, FMoverInputCmdContext& InputCmdResult)
+{
+    FCharacterDefaultInputs& CharacterInputs = InputCmdResult.InputCollection.FindOrAddMutableDataByType<FCharacterDefaultInputs>();
+    FRMCMoverInputs& RMCInputs = InputCmdResult.InputCollection.FindOrAddMutableDataByType<FRMCMoverInputs>();
+
+    if (!Controller)
+    {
+        // Simulated and unpossessed pawns keep a neutral command
+        CharacterInputs.SetMoveInput(EMoveInputType::DirectionalIntent, FVector::ZeroVector);
+        RMCInputs = FRMCMoverInputs();
+        return;
+    }
+
+    // Turn the axes into a world-space intent relative to the control yaw
+    const FRotator ControlRotation = Controller->GetControlRotation();
+    const FRotator YawRotation(0, ControlRotation.Yaw, 0);
+    const FRotationMatrix YawMatrix(YawRotation);
+    const FVector MoveIntent = (YawMatrix.GetUnitAxis(EAxis::X) * ForwardInputValue + YawMatrix.GetUnitAxis(EAxis::Y) * RightInputValue).GetClampedToMaxSize(1.0f);
+
+    CharacterInputs.SetMoveInput(EMoveInputType::DirectionalIntent, MoveIntent);
+    CharacterInputs.ControlRotation = ControlRotation;
+
+    // Face the direction of travel, like bOrientRotationToMovement on ARMCCharacter
+    CharacterInputs.OrientationIntent = MoveIntent.IsNearlyZero() ? FVector::ZeroVector : MoveIntent.GetSafeNormal();
+
+    CharacterInputs.bIsJumpPressed = bIsJumpPressed;
+    CharacterInputs.bIsJumpJustPressed = bIsJumpJustPressed;
+
+    RMCInputs.bIsSlidePressed = bIsSlidePressed;
+    RMCInputs.bIsSlideJustPressed = bIsSlideJustPressed;
+    RMCInputs.bIsDashJustPressed = bIsDashJustPressed;
+
+    // Presses count once
+    bIsJumpJustPressed = false;
+    bIsSlideJustPressed = false;
+    bIsDashJustPressed = false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Input handlers
+
+void ARMCMoverCharacter::MoveForward(float Value)
+{
+    ForwardInputValue = Value;
+}
+
+void ARMCMoverCharacter::MoveRight(float Value)
+{
+    RightInputValue = Value;
+}
+
+void ARMCMoverCharacter::Turn(float Value)
+{
+    AddControllerYawInput(Value);
+}
+
+void ARMCMoverCharacter::LookUp(float Value)
+{
+    AddControllerPitchInput(Value);
+}
+
+void ARMCMoverCharacter::TurnAtRate(float Rate)
+{
+    AddControllerYawInput(Rate * BaseTurnRate * GetWorld()->GetDeltaSeconds());
+}
+
+void ARMCMoverCharacter::LookUpAtRate(float Rate)
+{
+    AddControllerPitchInput(Rate * BaseLookUpRate * GetWorld()->GetDeltaSeconds());
+}
+
+void ARMCMoverCharacter::OnJumpPressed()
+{
+    bIsJumpPressed = true;
+    bIsJumpJustPressed = true;
+}
+
+void ARMCMoverCharacter::OnJumpReleased()
+{
+    bIsJumpPressed = false;
+}
+
+void ARMCMoverCharacter::OnDashPressed()
+{
+    bIsDashJustPressed = true;
+}
+
+void ARMCMoverCharacter::OnSlidePressed()
+{
+    bIsSlidePressed = true;
+    bIsSlideJustPressed = true;
+}
+
+void ARMCMoverCharacter::OnSlideReleased()
+{
+    bIsSlidePressed = false;
+}
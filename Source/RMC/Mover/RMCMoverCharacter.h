@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Pawn.h"
+#include "MoverSimulationTypes.h"
+#include "RMCMoverCharacter.generated.h"
+
+class UCapsuleComponent;
+class USkeletalMeshComponent;
+class USpringArmComponent;
+class UCameraComponent;
+class URMCMoverComponent;
+
+/**
+ * Pawn driven by the Mover backend. Takes the same legacy input bindings as ARMCCharacter so
+ * the two backends can be swapped through ARMCGameMode::MovementBackend and compared on the same maps.
+ */
+UCLASS(Blueprintable, BlueprintType, meta = (ShortTooltip = "Pawn with momentum-based movement on the Mover backend."))
+class RMC_API ARMCMoverCharacter : public APawn, public IMoverInputProducerInterface
+{
+    GENERATED_BODY()
+
+public:
+    ARMCMoverCharacter(const FObjectInitializer& ObjectInitializer);
+
+    virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
+
+    UFUNCTION(BlueprintPure, Category = "Movement")
+    URMCMoverComponent* GetRMCMoverComponent() const { return MoverComponent; }
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UCapsuleComponent* CapsuleComponent;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    USkeletalMeshComponent* Mesh;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera)
+    USpringArmComponent* CameraBoom;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera)
+    UCameraComponent* FollowCamera;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement")
+    URMCMoverComponent* MoverComponent;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera)
+    float BaseTurnRate;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera)
+    float BaseLookUpRate;
+
+protected:
+    /** Packs the input gathered since the last simulation tick into a Mover command */
+    virtual void ProduceInput_Implementation(int32 SimTimeMs, FMoverInputCmdContext& InputCmdResult) override;
+
+    // Input handlers, matching ARMCCharacter's bindings
+    void MoveForward(float Value);
+    void MoveRight(float Value);
+    void Turn(float Value);
+    void LookUp(float Value);
+    void TurnAtRate(float Rate);
+    void LookUpAtRate(float Rate);
+    void OnJumpPressed();
+    void OnJumpReleased();
+    void OnDashPressed();
+    void OnSlidePressed();
+    void OnSlideReleased();
+
+private:
+    // Axis values, turned into a world-space intent when input is produced
+    float ForwardInputValue;
+    float RightInputValue;
+
+    // Held buttons, and presses latched until the next command consumes them
+    uint8 bIsJumpPressed : 1;
+    uint8 bIsJumpJustPressed : 1;
+    uint8 bIsSlidePressed : 1;
+    uint8 bIsSlideJustPressed : 1;
+    uint8 bIsDashJustPressed : 1;
+};
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMoverComponent.h"
+#include "RMCMoverModes.h"
+#include "RMCMoverTransitions.h"
+
+URMCMoverComponent::URMCMoverComponent()
+{
+    MaxWalkSpeed = 600.0f;
+    JumpZVelocity = 600.0f;
+
+    MovementProfile.ProfileName = TEXT("Default");
+
+    // Modes
+    MovementModes.Add(RMCMoverModeNames::Walking, CreateDefaultSubobject<URMCMoverWalkingMode>(TEXT("RMCWalkingMode")));
+    MovementModes.Add(RMCMoverModeNames::Falling, CreateDefaultSubobject<URMCMoverFallingMode>(TEXT("RMCFallingMode")));
+    MovementModes.Add(RMCMoverModeNames::WallRunning, CreateDefaultSubobject<URMCMoverWallRunMode>(TEXT("RMCWallRunMode")));
+    MovementModes.Add(RMCMoverModeNames::Sliding, CreateDefaultSubobject<URMCMoverSlideMode>(TEXT("RMCSlideMode")));
+    MovementModes.Add(RMCMoverModeNames::Dashing, CreateDefaultSubobject<URMCMoverDashMode>(TEXT("RMCDashMode")));
+    StartingMovementMode = RMCMoverModeNames::Walking;
+
+    // Transitions check the current mode themselves, so they all live on the component
+    Transitions.Add(CreateDefaultSubobject<URMCMoverDashTransition>(TEXT("RMCDashTransition")));
+    Transitions.Add(CreateDefaultSubobject<URMCMoverSlideTransition>(TEXT("RMCSlideTransition")));
+    Transitions.Add(CreateDefaultSubobject<URMCMoverWallRunTransition>(TEXT("RMCWallRunTransition")));
+
+    // RMC state rides along with the default sync state and carries over between frames
+    PersistentSyncStateDataTypes.Add(FMoverDataPersistence(FRMCMoverSyncState::StaticStruct(), true));
+}
+
+FRMCMovementParams URMCMoverComponent::MakeMovementParams() const
+{
+    const UWorld* World = GetWorld();
+    return FRMCMoverRules::MakeParams(MovementProfile, MaxWalkSpeed, World ? World->GetGravityZ() : -980.0f);
+}
+
+const FRMCMoverSyncState* URMCMoverComponent::GetRMCSyncState() const
+{
+    return GetSyncState().SyncStateCollection.FindDataByType<FRMCMoverSyncState>();
+}
+
+float URMCMoverComponent::GetMomentum() const
+{
+    const FRMCMoverSyncState* RMCState = GetRMCSyncState();
+    return RMCState ? RMCState->Momentum : 0.0f;
+}
+
+bool URMCMoverComponent::IsWallRunning() const
+{
+    return GetMovementModeName() == RMCMoverModeNames::WallRunning;
+}
+
+bool URMCMoverComponent::IsSliding() const
+{
+    return GetMovementModeName() == RMCMoverModeNames::Sliding;
+}
+
+bool URMCMoverComponent::IsDashing() const
+{
+    return GetMovementModeName() == RMCMoverModeNames::Dashing;
+}
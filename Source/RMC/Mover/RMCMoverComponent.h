@@ -0,0 +1,52 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MoverComponent.h"
+#include "../Components/Movement/RMCMovementComponent.h"
+#include "RMCMoverTypes.h"
+#include "RMCMoverComponent.generated.h"
+
+/**
+ * Mover backend for RMC movement. Registers the RMC modes and transitions and carries
+ * FRMCMoverSyncState, so wall running, sliding, dashing, double jumps and momentum are
+ * predicted and rolled back by Network Prediction instead of the character movement saved-move path.
+ */
+UCLASS(ClassGroup = Movement, meta = (BlueprintSpawnableComponent))
+class RMC_API URMCMoverComponent : public UMoverComponent
+{
+    GENERATED_BODY()
+
+public:
+    URMCMoverComponent();
+
+    /** Tuning shared with URMCMovementComponent, so both backends can run the same profile */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Profile")
+    FMovementPhysicsProfile MovementProfile;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement", meta = (ClampMin = "0"))
+    float MaxWalkSpeed;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement", meta = (ClampMin = "0"))
+    float JumpZVelocity;
+
+    /** Simulation parameters for the current profile */
+    FRMCMovementParams MakeMovementParams() const;
+
+    /** RMC state from the most recent simulation frame */
+    UFUNCTION(BlueprintPure, Category = "Movement")
+    float GetMomentum() const;
+
+    UFUNCTION(BlueprintPure, Category = "Movement")
+    bool IsWallRunning() const;
+
+    UFUNCTION(BlueprintPure, Category = "Movement")
+    bool IsSliding() const;
+
+    UFUNCTION(BlueprintPure, Category = "Movement")
+    bool IsDashing() const;
+
+protected:
+    const FRMCMoverSyncState* GetRMCSyncState() const;
+};
@@ -0,0 +1,471 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMoverModes.h"
+#include "RMCMoverComponent.h"
+#include "MoverComponent.h"
+
+namespace RMCMoverModes
+{
+    static const URMCMoverComponent* GetRMCMover(const UObject* Mode)
+    {
+        return Mode->GetTypedOuter<URMCMoverComponent>();
+    }
+
+    static const FCharacterDefaultInputs* GetCharacterInputs(const FMoverTickStartData& StartState)
+    {
+        return StartState.InputCmd.InputCollection.FindDataByType<FCharacterDefaultInputs>();
+    }
+
+    static const FRMCMoverInputs* GetRMCInputs(const FMoverTickStartData& StartState)
+    {
+        return StartState.InputCmd.InputCollection.FindDataByType<FRMCMoverInputs>();
+    }
+
+    static FVector GetMoveInput(const FMoverTickStartData& StartState)
+    {
+        const FCharacterDefaultInputs* Inputs = GetCharacterInputs(StartState);
+        return Inputs ? Inputs->GetMoveInput() : FVector::ZeroVector;
+    }
+
+    static bool IsJumpJustPressed(const FMoverTickStartData& StartState)
+    {
+        const FCharacterDefaultInputs* Inputs = GetCharacterInputs(StartState);
+        return Inputs && Inputs->bIsJumpJustPressed;
+    }
+
+    static float ToSeconds(const FMoverTimeStep& TimeStep)
+    {
+        return TimeStep.StepMs * 0.001f;
+    }
+
+    static void CapProposedVelocity(const FRMCMovementParams& Params, FProposedMove& InOutProposedMove)
+    {
+        float PreviousSpeed = 0.0f;
+        float NewSpeed = 0.0f;
+        FRMCMovementSimulation::ApplySpeedCap(Params, InOutProposedMove.LinearVelocity, PreviousSpeed, NewSpeed);
+    }
+
+    /** Leaves the mode without consuming any of the step, so the next mode simulates it */
+    static void HandOff(const FSimulationTickParams& Params, FMoverTickEndData& OutputState, FName NextMode)
+    {
+        OutputState.MovementEndState.NextModeName = NextMode;
+        OutputState.MovementEndState.RemainingMs = Params.TimeStep.StepMs;
+    }
+
+    /** Leaves a custom mode for walking or falling. ActiveMode follows, so re-entering the mode next step starts it afresh. */
+    static void ExitTo(FMoverTickEndData& OutputState, FRMCMoverSyncState& RMCState, bool bOnGround)
+    {
+        OutputState.MovementEndState.NextModeName = bOnGround ? RMCMoverModeNames::Walking : RMCMoverModeNames::Falling;
+        RMCState.ActiveMode = static_cast<uint8>(bOnGround ? ERMCMovementSimMode::Walking : ERMCMovementSimMode::Falling);
+    }
+
+    static void SetVelocity(FMoverTickEndData& OutputState, const FVector& NewVelocity)
+    {
+        FMoverDefaultSyncState& OutputSyncState = OutputState.SyncState.SyncStateCollection.FindOrAddMutableDataByType<FMoverDefaultSyncState>();
+        OutputSyncState.SetTransforms_WorldSpace(
+            OutputSyncState.GetLocation_WorldSpace(),
+            OutputSyncState.GetOrientation_WorldSpace(),
+            NewVelocity,
+            nullptr);
+    }
+
+    /** Mirrors URMCMovementComponent::StartWallRun: run along the wall, in the direction of travel or input */
+    static FVector ComputeWallRunEntryVelocity(const FRMCMovementParams& Params, const FVector& Velocity, const FVector& WallNormal, const FVector& MoveInput)
+    {
+        FVector WallRunDirection = FVector::CrossProduct(WallNormal, FVector(0, 0, 1)).GetSafeNormal();
+
+        const FVector VelocityDir = Velocity.GetSafeNormal2D();
+        if (FVector::DotProduct(VelocityDir, -WallRunDirection) > FVector::DotProduct(VelocityDir, WallRunDirection))
+        {
+            WallRunDirection = -WallRunDirection;
+        }
+
+        if (!MoveInput.IsNearlyZero())
+        {
+            const FVector InputAlongWall = FVector::VectorPlaneProject(MoveInput, WallNormal).GetSafeNormal2D();
+            if (FVector::DotProduct(InputAlongWall, -WallRunDirection) > FVector::DotProduct(InputAlongWall, WallRunDirection))
+            {
+                WallRunDirection = -WallRunDirection;
+            }
+        }
+
+        FVector NewVelocity = WallRunDirection * FMath::Max(Velocity.Size2D(), Params.WallRunSpeed);
+
+        // Keep some upward speed so the transition is smooth, drop any downward speed
+        NewVelocity.Z = Velocity.Z > 0.0f ? Velocity.Z * 0.5f : 0.0f;
+
+        return NewVelocity;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// URMCMoverWalkingMode
+
+void URMCMoverWalkingMode::OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const
+{
+    Super::OnGenerateMove_Implementation(StartState, TimeStep, OutProposedMove);
+
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    if (!Mover)
+    {
+        return;
+    }
+
+    if (RMCMoverModes::IsJumpJustPressed(StartState))
+    {
+        OutProposedMove.LinearVelocity.Z = Mover->JumpZVelocity;
+        OutProposedMove.PreferredMode = RMCMoverModeNames::Falling;
+    }
+
+    RMCMoverModes::CapProposedVelocity(Mover->MakeMovementParams(), OutProposedMove);
+}
+
+void URMCMoverWalkingMode::OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
+{
+    FRMCMoverSyncState& RMCState = FRMCMoverRules::BeginStep(Params, OutputState);
+
+    Super::OnSimulationTick_Implementation(Params, OutputState);
+
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    const FMoverDefaultSyncState* OutputSyncState = OutputState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    if (!Mover || !OutputSyncState)
+    {
+        return;
+    }
+
+    const bool bOnGround = OutputState.MovementEndState.NextModeName.IsNone()
+        || OutputState.MovementEndState.NextModeName == RMCMoverModeNames::Walking;
+
+    FRMCMoverRules::UpdateBookkeeping(Mover->MakeMovementParams(), OutputSyncState->GetVelocity_WorldSpace(), bOnGround,
+        RMCMoverModes::ToSeconds(Params.TimeStep), RMCState);
+    RMCState.ActiveMode = static_cast<uint8>(ERMCMovementSimMode::Walking);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// URMCMoverFallingMode
+
+bool URMCMoverFallingMode::ShouldDoubleJump(const FMoverTickStartData& StartState, const FMovementPhysicsProfile& Profile)
+{
+    if (!RMCMoverModes::IsJumpJustPressed(StartState))
+    {
+        return false;
+    }
+
+    const FRMCMoverSyncState RMCState = FRMCMoverRules::GetStartState(StartState);
+    return !RMCState.bHasDoubleJumped && RMCState.Momentum >= Profile.MaxMomentum * 0.2f;
+}
+
+void URMCMoverFallingMode::OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const
+{
+    Super::OnGenerateMove_Implementation(StartState, TimeStep, OutProposedMove);
+
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    if (!Mover)
+    {
+        return;
+    }
+
+    if (ShouldDoubleJump(StartState, Mover->MovementProfile))
+    {
+        OutProposedMove.LinearVelocity.Z = Mover->MovementProfile.DoubleJumpZVelocity;
+    }
+
+    RMCMoverModes::CapProposedVelocity(Mover->MakeMovementParams(), OutProposedMove);
+}
+
+void URMCMoverFallingMode::OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
+{
+    FRMCMoverSyncState& RMCState = FRMCMoverRules::BeginStep(Params, OutputState);
+
+    Super::OnSimulationTick_Implementation(Params, OutputState);
+
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    const FMoverDefaultSyncState* OutputSyncState = OutputState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    if (!Mover || !OutputSyncState)
+    {
+        return;
+    }
+
+    const FRMCMovementParams MovementParams = Mover->MakeMovementParams();
+
+    // The jump velocity itself went out with the proposed move; record that it was used
+    if (ShouldDoubleJump(Params.StartState, Mover->MovementProfile))
+    {
+        RMCState.bHasDoubleJumped = true;
+        FRMCMoverRules::AddMomentum(MovementParams, RMCState, 10.0f);
+    }
+
+    const bool bLanded = OutputState.MovementEndState.NextModeName == RMCMoverModeNames::Walking;
+
+    FRMCMoverRules::UpdateBookkeeping(MovementParams, OutputSyncState->GetVelocity_WorldSpace(), bLanded,
+        RMCMoverModes::ToSeconds(Params.TimeStep), RMCState);
+    RMCState.ActiveMode = static_cast<uint8>(ERMCMovementSimMode::Falling);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// URMCMoverWallRunMode
+
+void URMCMoverWallRunMode::OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const
+{
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    const FMoverDefaultSyncState* StartSyncState = StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    if (!Mover || !StartSyncState)
+    {
+        return;
+    }
+
+    const FRMCMovementParams MovementParams = Mover->MakeMovementParams();
+    const FRMCMoverSyncState RMCState = FRMCMoverRules::GetStartState(StartState);
+
+    OutProposedMove.LinearVelocity = StartSyncState->GetVelocity_WorldSpace();
+
+    // Entry velocity is set by the simulation tick once the wall has been found
+    if (RMCState.GetActiveMode() == ERMCMovementSimMode::WallRunning)
+    {
+        OutProposedMove.LinearVelocity = FRMCMovementSimulation::ApplyWallRunForces(MovementParams, OutProposedMove.LinearVelocity,
+            RMCState.WallNormal, RMCMoverModes::GetMoveInput(StartState), RMCMoverModes::ToSeconds(TimeStep));
+    }
+
+    RMCMoverModes::CapProposedVelocity(MovementParams, OutProposedMove);
+}
+
+void URMCMoverWallRunMode::OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
+{
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    const FMoverDefaultSyncState* StartSyncState = Params.StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    USceneComponent* UpdatedComponent = Params.MovingComps.UpdatedComponent.Get();
+    if (!Mover || !StartSyncState || !UpdatedComponent)
+    {
+        RMCMoverModes::HandOff(Params, OutputState, RMCMoverModeNames::Falling);
+        return;
+    }
+
+    const FMovementPhysicsProfile& Profile = Mover->MovementProfile;
+    const FRMCMovementParams MovementParams = Mover->MakeMovementParams();
+    const float DeltaSeconds = RMCMoverModes::ToSeconds(Params.TimeStep);
+
+    FRMCMoverSyncState& RMCState = FRMCMoverRules::BeginStep(Params, OutputState);
+    FVector Velocity = Params.ProposedMove.LinearVelocity;
+    bool bWallJump = false;
+
+    if (RMCState.GetActiveMode() != ERMCMovementSimMode::WallRunning)
+    {
+        FRMCMovementSimState SimState;
+        SimState.Velocity = StartSyncState->GetVelocity_WorldSpace();
+        SimState.Mode = ERMCMovementSimMode::WallRunning;
+
+        const FRMCMoverSceneQuery StartScene(UpdatedComponent, StartSyncState->GetLocation_WorldSpace(), Profile.MaxWallRunSurfaceAngle);
+        FVector WallNormal;
+        if (!StartScene.FindWall(0, SimState, WallNormal))
+        {
+            RMCMoverModes::HandOff(Params, OutputState, RMCMoverModeNames::Falling);
+            return;
+        }
+
+        RMCState.WallNormal = WallNormal;
+        RMCState.WallRunTimeRemaining = Profile.MaxWallRunTime;
+        Velocity = RMCMoverModes::ComputeWallRunEntryVelocity(MovementParams, SimState.Velocity, WallNormal, RMCMoverModes::GetMoveInput(Params.StartState));
+        FRMCMoverRules::AddMomentum(MovementParams, RMCState, 10.0f);
+    }
+    else if (RMCMoverModes::IsJumpJustPressed(Params.StartState))
+    {
+        // Jump away from the wall and upward
+        Velocity = (RMCState.WallNormal + FVector(0, 0, 0.5f)).GetSafeNormal() * Profile.WallRunJumpOffForce;
+        Velocity.Z = Mover->JumpZVelocity;
+        FRMCMoverRules::AddMomentum(MovementParams, RMCState, 15.0f);
+        bWallJump = true;
+    }
+    else
+    {
+        RMCState.WallRunTimeRemaining = FMath::Max(RMCState.WallRunTimeRemaining - DeltaSeconds, 0.0f);
+    }
+
+    FRMCMoverRules::MoveAndRecord(Params, Velocity, DeltaSeconds, OutputState);
+
+    // Probe from where the move ended
+    FRMCMovementSimState EndSimState;
+    EndSimState.Velocity = Velocity;
+    EndSimState.Mode = ERMCMovementSimMode::WallRunning;
+
+    const FRMCMoverSceneQuery EndScene(UpdatedComponent, UpdatedComponent->GetComponentLocation(), Profile.MaxWallRunSurfaceAngle);
+    FVector WallNormal;
+    const bool bFoundWall = !bWallJump && EndScene.FindWall(0, EndSimState, WallNormal);
+    const bool bOnGround = EndScene.IsMovingOnGround(0, EndSimState);
+    if (bFoundWall)
+    {
+        RMCState.WallNormal = WallNormal;
+    }
+
+    FRMCMoverRules::UpdateBookkeeping(MovementParams, Velocity, bOnGround, DeltaSeconds, RMCState);
+    RMCState.ActiveMode = static_cast<uint8>(ERMCMovementSimMode::WallRunning);
+
+    if (bWallJump || bOnGround || RMCState.WallRunTimeRemaining <= 0.0f || FRMCMovementSimulation::ShouldEndWallRun(Velocity, bFoundWall))
+    {
+        RMCState.WallNormal = FVector::ZeroVector;
+        RMCState.WallRunTimeRemaining = 0.0f;
+        RMCMoverModes::ExitTo(OutputState, RMCState, bOnGround);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// URMCMoverSlideMode
+
+void URMCMoverSlideMode::OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const
+{
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    const FMoverDefaultSyncState* StartSyncState = StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    if (!Mover || !StartSyncState)
+    {
+        return;
+    }
+
+    const FRMCMovementParams MovementParams = Mover->MakeMovementParams();
+    const FRMCMoverSyncState RMCState = FRMCMoverRules::GetStartState(StartState);
+
+    OutProposedMove.LinearVelocity = StartSyncState->GetVelocity_WorldSpace();
+
+    if (RMCState.GetActiveMode() == ERMCMovementSimMode::Sliding)
+    {
+        FRMCMovementSimState SimState;
+        SimState.Velocity = OutProposedMove.LinearVelocity;
+        SimState.Mode = ERMCMovementSimMode::Sliding;
+
+        const FRMCMoverSceneQuery Scene(Mover->GetUpdatedComponent(), StartSyncState->GetLocation_WorldSpace(), Mover->MovementProfile.MaxWallRunSurfaceAngle);
+
+        OutProposedMove.LinearVelocity = FRMCMovementSimulation::ApplySlideForces(MovementParams, OutProposedMove.LinearVelocity,
+            Scene.GetFloorNormal(0, SimState), RMCMoverModes::GetMoveInput(StartState), RMCMoverModes::ToSeconds(TimeStep));
+    }
+
+    RMCMoverModes::CapProposedVelocity(MovementParams, OutProposedMove);
+}
+
+void URMCMoverSlideMode::OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
+{
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    const FMoverDefaultSyncState* StartSyncState = Params.StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    USceneComponent* UpdatedComponent = Params.MovingComps.UpdatedComponent.Get();
+    if (!Mover || !StartSyncState || !UpdatedComponent)
+    {
+        RMCMoverModes::HandOff(Params, OutputState, RMCMoverModeNames::Walking);
+        return;
+    }
+
+    const FMovementPhysicsProfile& Profile = Mover->MovementProfile;
+    const FRMCMovementParams MovementParams = Mover->MakeMovementParams();
+    const float DeltaSeconds = RMCMoverModes::ToSeconds(Params.TimeStep);
+
+    FRMCMoverSyncState& RMCState = FRMCMoverRules::BeginStep(Params, OutputState);
+    FVector Velocity = Params.ProposedMove.LinearVelocity;
+
+    if (RMCState.GetActiveMode() != ERMCMovementSimMode::Sliding)
+    {
+        RMCState.SlideTimeRemaining = Profile.SlideMaxDuration;
+        Velocity = StartSyncState->GetVelocity_WorldSpace().GetSafeNormal2D() * Profile.SlideSpeed;
+        FRMCMoverRules::AddMomentum(MovementParams, RMCState, 5.0f);
+    }
+    else
+    {
+        RMCState.SlideTimeRemaining = FMath::Max(RMCState.SlideTimeRemaining - DeltaSeconds, 0.0f);
+    }
+
+    FRMCMoverRules::MoveAndRecord(Params, Velocity, DeltaSeconds, OutputState);
+
+    FRMCMovementSimState EndSimState;
+    EndSimState.Velocity = Velocity;
+    EndSimState.Mode = ERMCMovementSimMode::Sliding;
+
+    const FRMCMoverSceneQuery EndScene(UpdatedComponent, UpdatedComponent->GetComponentLocation(), Profile.MaxWallRunSurfaceAngle);
+    const bool bOnGround = EndScene.IsMovingOnGround(0, EndSimState);
+
+    FRMCMoverRules::UpdateBookkeeping(MovementParams, Velocity, bOnGround, DeltaSeconds, RMCState);
+    RMCState.ActiveMode = static_cast<uint8>(ERMCMovementSimMode::Sliding);
+
+    // Same exits as the character movement backend: release, timeout, too slow or airborne, and
+    // letting go of the stick once the minimum duration has passed
+    const FRMCMoverInputs* RMCInputs = RMCMoverModes::GetRMCInputs(Params.StartState);
+    const bool bReleased = !RMCInputs || !RMCInputs->bIsSlidePressed;
+    const bool bMinDurationElapsed = RMCState.SlideTimeRemaining <= Profile.SlideMaxDuration - Profile.SlideMinDuration;
+    const bool bNoInput = RMCMoverModes::GetMoveInput(Params.StartState).Size() < 0.1f;
+
+    if (bReleased || RMCState.SlideTimeRemaining <= 0.0f || FRMCMovementSimulation::ShouldEndSlide(MovementParams, Velocity, bOnGround)
+        || (bMinDurationElapsed && bNoInput))
+    {
+        RMCState.SlideTimeRemaining = 0.0f;
+        RMCMoverModes::ExitTo(OutputState, RMCState, bOnGround);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// URMCMoverDashMode
+
+void URMCMoverDashMode::OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const
+{
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    const FMoverDefaultSyncState* StartSyncState = StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    if (!Mover || !StartSyncState)
+    {
+        return;
+    }
+
+    const FRMCMoverSyncState RMCState = FRMCMoverRules::GetStartState(StartState);
+
+    // The dash ignores the speed cap, as it does on the character movement backend
+    OutProposedMove.LinearVelocity = RMCState.GetActiveMode() == ERMCMovementSimMode::Dashing
+        ? FRMCMovementSimulation::ApplyDashForces(Mover->MakeMovementParams(), RMCState.DashDirection)
+        : StartSyncState->GetVelocity_WorldSpace();
+}
+
+void URMCMoverDashMode::OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
+{
+    const URMCMoverComponent* Mover = RMCMoverModes::GetRMCMover(this);
+    const FMoverDefaultSyncState* StartSyncState = Params.StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    USceneComponent* UpdatedComponent = Params.MovingComps.UpdatedComponent.Get();
+    if (!Mover || !StartSyncState || !UpdatedComponent)
+    {
+        RMCMoverModes::HandOff(Params, OutputState, RMCMoverModeNames::Falling);
+        return;
+    }
+
+    const FMovementPhysicsProfile& Profile = Mover->MovementProfile;
+    const FRMCMovementParams MovementParams = Mover->MakeMovementParams();
+    const float DeltaSeconds = RMCMoverModes::ToSeconds(Params.TimeStep);
+
+    FRMCMoverSyncState& RMCState = FRMCMoverRules::BeginStep(Params, OutputState);
+    FVector Velocity = Params.ProposedMove.LinearVelocity;
+
+    if (RMCState.GetActiveMode() != ERMCMovementSimMode::Dashing)
+    {
+        RMCState.DashDirection = FRMCMoverRules::ComputeDashDirection(RMCMoverModes::GetCharacterInputs(Params.StartState), *StartSyncState);
+        RMCState.DashTimeRemaining = Profile.DashDuration;
+        RMCState.DashCooldownRemaining = Profile.DashCooldown;
+        Velocity = FRMCMovementSimulation::ApplyDashForces(MovementParams, RMCState.DashDirection);
+        FRMCMoverRules::AddMomentum(MovementParams, RMCState, 20.0f);
+    }
+    else
+    {
+        RMCState.DashTimeRemaining = FMath::Max(RMCState.DashTimeRemaining - DeltaSeconds, 0.0f);
+    }
+
+    FRMCMoverRules::MoveAndRecord(Params, Velocity, DeltaSeconds, OutputState);
+
+    FRMCMovementSimState EndSimState;
+    EndSimState.Velocity = Velocity;
+    EndSimState.Mode = ERMCMovementSimMode::Dashing;
+
+    const FRMCMoverSceneQuery EndScene(UpdatedComponent, UpdatedComponent->GetComponentLocation(), Profile.MaxWallRunSurfaceAngle);
+    const bool bOnGround = EndScene.IsMovingOnGround(0, EndSimState);
+
+    FRMCMoverRules::UpdateBookkeeping(MovementParams, Velocity, bOnGround, DeltaSeconds, RMCState);
+    RMCState.ActiveMode = static_cast<uint8>(ERMCMovementSimMode::Dashing);
+
+    if (RMCState.DashTimeRemaining <= 0.0f)
+    {
+        // Carry a boost out of the dash
+        const FMoverDefaultSyncState* OutputSyncState = OutputState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+        const FVector EndVelocity = OutputSyncState ? OutputSyncState->GetVelocity_WorldSpace() : Velocity;
+        const float Boost = bOnGround ? Profile.DashGroundSpeedBoost : Profile.DashAirSpeedBoost;
+        RMCMoverModes::SetVelocity(OutputState, EndVelocity + RMCState.DashDirection * Boost);
+
+        RMCMoverModes::ExitTo(OutputState, RMCState, bOnGround);
+    }
+}
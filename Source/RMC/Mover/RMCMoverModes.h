@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovementMode.h"
+#include "DefaultMovementSet/Modes/WalkingMode.h"
+#include "DefaultMovementSet/Modes/FallingMode.h"
+#include "RMCMoverTypes.h"
+#include "RMCMoverModes.generated.h"
+
+class URMCMoverComponent;
+
+/**
+ * Default walking plus momentum bookkeeping, the double jump reset and the grounded jump
+ */
+UCLASS()
+class RMC_API URMCMoverWalkingMode : public UWalkingMode
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const override;
+    virtual void OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState) override;
+};
+
+/**
+ * Default falling plus momentum bookkeeping and the double jump
+ */
+UCLASS()
+class RMC_API URMCMoverFallingMode : public UFallingMode
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const override;
+    virtual void OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState) override;
+
+    /** Whether the step starting from this state triggers the double jump */
+    static bool ShouldDoubleJump(const FMoverTickStartData& StartState, const FMovementPhysicsProfile& Profile);
+};
+
+/**
+ * Runs along a wall with reduced gravity until the wall is lost, the time runs out or the player jumps off
+ */
+UCLASS()
+class RMC_API URMCMoverWallRunMode : public UBaseMovementMode
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const override;
+    virtual void OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState) override;
+};
+
+/**
+ * Ground slide that bleeds speed through friction and speeds up downhill
+ */
+UCLASS()
+class RMC_API URMCMoverSlideMode : public UBaseMovementMode
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const override;
+    virtual void OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState) override;
+};
+
+/**
+ * Constant-velocity dash, followed by a speed boost in the dash direction
+ */
+UCLASS()
+class RMC_API URMCMoverDashMode : public UBaseMovementMode
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnGenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const override;
+    virtual void OnSimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState) override;
+};
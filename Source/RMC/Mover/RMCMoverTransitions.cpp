@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMoverTransitions.h"
+#include "RMCMoverComponent.h"
+#include "RMCMoverTypes.h"
+
+namespace RMCMoverTransitions
+{
+    /** Transition to NextMode, or none */
+    static FTransitionEvalResult MakeResult(bool bTransition, FName NextMode)
+    {
+        FTransitionEvalResult EvalResult = FTransitionEvalResult::NoTransition;
+        if (bTransition)
+        {
+            EvalResult.NextMode = NextMode;
+        }
+
+        return EvalResult;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// URMCMoverSlideTransition
+
+FTransitionEvalResult URMCMoverSlideTransition::OnEvaluate_Implementation(const FSimulationTickParams& Params) const
+{
+    const URMCMoverComponent* Mover = GetTypedOuter<URMCMoverComponent>();
+    const FRMCMoverInputs* RMCInputs = Params.StartState.InputCmd.InputCollection.FindDataByType<FRMCMoverInputs>();
+    const FMoverDefaultSyncState* SyncState = Params.StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    if (!Mover || !RMCInputs || !SyncState || !RMCInputs->bIsSlideJustPressed
+        || Params.StartState.SyncState.MovementMode != RMCMoverModeNames::Walking)
+    {
+        return FTransitionEvalResult::NoTransition;
+    }
+
+    const FMovementPhysicsProfile& Profile = Mover->MovementProfile;
+    const FRMCMoverSyncState RMCState = FRMCMoverRules::GetStartState(Params.StartState);
+
+    const bool bFastEnough = SyncState->GetVelocity_WorldSpace().SizeSquared() >= FMath::Square(Profile.SlideMinSpeed);
+    const bool bEnoughMomentum = RMCState.Momentum >= Profile.MaxMomentum * 0.1f;
+
+    return RMCMoverTransitions::MakeResult(bFastEnough && bEnoughMomentum, RMCMoverModeNames::Sliding);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// URMCMoverWallRunTransition
+
+FTransitionEvalResult URMCMoverWallRunTransition::OnEvaluate_Implementation(const FSimulationTickParams& Params) const
+{
+    const URMCMoverComponent* Mover = GetTypedOuter<URMCMoverComponent>();
+    const FMoverDefaultSyncState* SyncState = Params.StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+    const USceneComponent* UpdatedComponent = Params.MovingComps.UpdatedComponent.Get();
+    if (!Mover || !SyncState || !UpdatedComponent || Params.StartState.SyncState.MovementMode != RMCMoverModeNames::Falling)
+    {
+        return FTransitionEvalResult::NoTransition;
+    }
+
+    const FMovementPhysicsProfile& Profile = Mover->MovementProfile;
+    const FRMCMoverSyncState RMCState = FRMCMoverRules::GetStartState(Params.StartState);
+    const FVector Velocity = SyncState->GetVelocity_WorldSpace();
+
+    // Cheap checks first, matching ARMCCharacter::TryWallRun and URMCMovementComponent::CanWallRun
+    if (Velocity.Size2D() <= 200.0f || RMCState.Momentum < Profile.MaxMomentum * 0.2f)
+    {
+        return FTransitionEvalResult::NoTransition;
+    }
+
+    const FRMCMoverSceneQuery Scene(UpdatedComponent, SyncState->GetLocation_WorldSpace(), Profile.MaxWallRunSurfaceAngle);
+    if (Scene.GetHeightAboveFloor() < Profile.MinWallRunHeight)
+    {
+        return FTransitionEvalResult::NoTransition;
+    }
+
+    FRMCMovementSimState SimState;
+    SimState.Velocity = Velocity;
+    SimState.Mode = ERMCMovementSimMode::Falling;
+
+    FVector WallNormal;
+    return RMCMoverTransitions::MakeResult(Scene.FindWall(0, SimState, WallNormal), RMCMoverModeNames::WallRunning);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// URMCMoverDashTransition
+
+FTransitionEvalResult URMCMoverDashTransition::OnEvaluate_Implementation(const FSimulationTickParams& Params) const
+{
+    const URMCMoverComponent* Mover = GetTypedOuter<URMCMoverComponent>();
+    const FRMCMoverInputs* RMCInputs = Params.StartState.InputCmd.InputCollection.FindDataByType<FRMCMoverInputs>();
+    if (!Mover || !RMCInputs || !RMCInputs->bIsDashJustPressed
+        || Params.StartState.SyncState.MovementMode == RMCMoverModeNames::Dashing)
+    {
+        return FTransitionEvalResult::NoTransition;
+    }
+
+    const FRMCMoverSyncState RMCState = FRMCMoverRules::GetStartState(Params.StartState);
+    const bool bOffCooldown = RMCState.DashCooldownRemaining <= 0.0f;
+    const bool bEnoughMomentum = RMCState.Momentum >= Mover->MovementProfile.MaxMomentum * 0.3f;
+
+    return RMCMoverTransitions::MakeResult(bOffCooldown && bEnoughMomentum, RMCMoverModeNames::Dashing);
+}
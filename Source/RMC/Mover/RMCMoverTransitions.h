@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovementModeTransition.h"
+#include "RMCMoverTransitions.generated.h"
+
+/**
+ * Walking -> Sliding when slide is pressed at speed with enough momentum
+ */
+UCLASS()
+class RMC_API URMCMoverSlideTransition : public UBaseMovementModeTransition
+{
+    GENERATED_BODY()
+
+public:
+    virtual FTransitionEvalResult OnEvaluate_Implementation(const FSimulationTickParams& Params) const override;
+};
+
+/**
+ * Falling -> WallRunning when moving fast enough beside a runnable wall, clear of the floor
+ */
+UCLASS()
+class RMC_API URMCMoverWallRunTransition : public UBaseMovementModeTransition
+{
+    GENERATED_BODY()
+
+public:
+    virtual FTransitionEvalResult OnEvaluate_Implementation(const FSimulationTickParams& Params) const override;
+};
+
+/**
+ * Any mode -> Dashing when dash is pressed off cooldown with enough momentum
+ */
+UCLASS()
+class RMC_API URMCMoverDashTransition : public UBaseMovementModeTransition
+{
+    GENERATED_BODY()
+
+public:
+    virtual FTransitionEvalResult OnEvaluate_Implementation(const FSimulationTickParams& Params) const override;
+};
@@ -0,0 +1,333 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCMoverTypes.h"
+#include "../Components/Movement/RMCMovementComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "MoverComponent.h"
+#include "MoveLibrary/MovementUtils.h"
+#include "MoveLibrary/MovementRecord.h"
+
+namespace RMCMoverModeNames
+{
+    const FName Walking = TEXT("Walking");
+    const FName Falling = TEXT("Falling");
+    const FName WallRunning = TEXT("RMC_WallRunning");
+    const FName Sliding = TEXT("RMC_Sliding");
+    const FName Dashing = TEXT("RMC_Dashing");
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FRMCMoverInputs
+
+FMoverDataStructBase* FRMCMoverInputs::Clone() const
+{
+    return new FRMCMoverInputs(*this);
+}
+
+bool FRMCMoverInputs::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Super::NetSerialize(Ar, Map, bOutSuccess);
+
+    Ar.SerializeBits(&bIsSlidePressed, 1);
+    Ar.SerializeBits(&bIsSlideJustPressed, 1);
+    Ar.SerializeBits(&bIsDashJustPressed, 1);
+
+    bOutSuccess = true;
+    return true;
+}
+
+void FRMCMoverInputs::ToString(FAnsiStringBuilderBase& Out) const
+{
+    Super::ToString(Out);
+
+    Out.Appendf("bIsSlidePressed: %i\n", bIsSlidePressed);
+    Out.Appendf("bIsSlideJustPressed: %i\n", bIsSlideJustPressed);
+    Out.Appendf("bIsDashJustPressed: %i\n", bIsDashJustPressed);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FRMCMoverSyncState
+
+FMoverDataStructBase* FRMCMoverSyncState::Clone() const
+{
+    return new FRMCMoverSyncState(*this);
+}
+
+bool FRMCMoverSyncState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Super::NetSerialize(Ar, Map, bOutSuccess);
+
+    Ar << ActiveMode;
+    Ar << Momentum;
+    Ar.SerializeBits(&bHasDoubleJumped, 1);
+
+    bool bOutSuccessLocal = true;
+    WallNormal.NetSerialize(Ar, Map, bOutSuccessLocal);
+    bOutSuccess &= bOutSuccessLocal;
+    DashDirection.NetSerialize(Ar, Map, bOutSuccessLocal);
+    bOutSuccess &= bOutSuccessLocal;
+
+    Ar << DashTimeRemaining;
+    Ar << DashCooldownRemaining;
+    Ar << WallRunTimeRemaining;
+    Ar << SlideTimeRemaining;
+
+    return true;
+}
+
+void FRMCMoverSyncState::ToString(FAnsiStringBuilderBase& Out) const
+{
+    Super::ToString(Out);
+
+    Out.Appendf("ActiveMode: %u\n", ActiveMode);
+    Out.Appendf("Momentum: %.2f\n", Momentum);
+    Out.Appendf("bHasDoubleJumped: %i\n", bHasDoubleJumped);
+    Out.Appendf("WallNormal: X=%.2f Y=%.2f Z=%.2f\n", WallNormal.X, WallNormal.Y, WallNormal.Z);
+    Out.Appendf("DashDirection: X=%.2f Y=%.2f Z=%.2f\n", DashDirection.X, DashDirection.Y, DashDirection.Z);
+    Out.Appendf("Timers: Dash=%.2f DashCooldown=%.2f WallRun=%.2f Slide=%.2f\n",
+        DashTimeRemaining, DashCooldownRemaining, WallRunTimeRemaining, SlideTimeRemaining);
+}
+
+bool FRMCMoverSyncState::ShouldReconcile(const FMoverDataStructBase& AuthorityState) const
+{
+    const FRMCMoverSyncState& Authority = static_cast<const FRMCMoverSyncState&>(AuthorityState);
+
+    return ActiveMode != Authority.ActiveMode
+        || bHasDoubleJumped != Authority.bHasDoubleJumped
+        || !FMath::IsNearlyEqual(Momentum, Authority.Momentum, 1.0f)
+        || !FMath::IsNearlyEqual(DashCooldownRemaining, Authority.DashCooldownRemaining, 0.05f);
+}
+
+void FRMCMoverSyncState::Interpolate(const FMoverDataStructBase& From, const FMoverDataStructBase& To, float Pct)
+{
+    const FRMCMoverSyncState& FromState = static_cast<const FRMCMoverSyncState&>(From);
+    const FRMCMoverSyncState& ToState = static_cast<const FRMCMoverSyncState&>(To);
+
+    // Discrete state snaps to whichever end is closer
+    *this = (Pct < 0.5f) ? FromState : ToState;
+
+    Momentum = FMath::Lerp(FromState.Momentum, ToState.Momentum, Pct);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FRMCMoverSceneQuery
+
+FRMCMoverSceneQuery::FRMCMoverSceneQuery(const USceneComponent* InUpdatedComponent, const FVector& InLocation, float InMaxWallRunSurfaceAngle)
+    : UpdatedComponent(InUpdatedComponent)
+    , Location(InLocation)
+    , MaxWallRunSurfaceAngle(InMaxWallRunSurfaceAngle)
+    , HalfHeight(0.0f)
+{
+    if (const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(UpdatedComponent))
+    {
+        HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+    }
+    else if (UpdatedComponent)
+    {
+        HalfHeight = UpdatedComponent->Bounds.BoxExtent.Z;
+    }
+}
+
+bool FRMCMoverSceneQuery::TraceFloor(FHitResult& OutHit, float Distance) const
+{
+    const UWorld* World = UpdatedComponent ? UpdatedComponent->GetWorld() : nullptr;
+    if (!World)
+    {
+        return false;
+    }
+
+    FCollisionQueryParams QueryParams;
+    QueryParams.AddIgnoredActor(UpdatedComponent->GetOwner());
+
+    return World->LineTraceSingleByChannel(OutHit, Location, Location - FVector(0, 0, HalfHeight + Distance), ECC_Visibility, QueryParams);
+}
+
+bool FRMCMoverSceneQuery::FindWall(int32 AgentIndex, const FRMCMovementSimState& State, FVector& OutWallNormal) const
+{
+    const UWorld* World = UpdatedComponent ? UpdatedComponent->GetWorld() : nullptr;
+    if (!World)
+    {
+        return false;
+    }
+
+    FVector VelocityDir = State.Velocity.GetSafeNormal2D();
+    if (VelocityDir.IsNearlyZero())
+    {
+        VelocityDir = UpdatedComponent->GetForwardVector().GetSafeNormal2D();
+    }
+    const FVector RightDir = FVector::CrossProduct(VelocityDir, FVector(0, 0, 1)).GetSafeNormal();
+
+    // Same probe set as URMCMovementComponent::FindWallRunSurface, minus the actor-relative duplicates
+    const FVector Directions[] =
+    {
+        VelocityDir,
+        RightDir,
+        -RightDir,
+        (VelocityDir + RightDir).GetSafeNormal(),
+        (VelocityDir - RightDir).GetSafeNormal()
+    };
+
+    float Radius = 0.0f;
+    if (const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(UpdatedComponent))
+    {
+        Radius = Capsule->GetScaledCapsuleRadius();
+    }
+    const float TraceDistance = Radius + 20.0f;
+    const float MaxZComponent = FMath::Sin(FMath::DegreesToRadians(MaxWallRunSurfaceAngle));
+
+    FCollisionQueryParams QueryParams;
+    QueryParams.AddIgnoredActor(UpdatedComponent->GetOwner());
+
+    for (const FVector& Direction : Directions)
+    {
+        FHitResult WallHit;
+        if (World->LineTraceSingleByChannel(WallHit, Location, Location + Direction * TraceDistance, ECC_Visibility, QueryParams)
+            && FMath::Abs(WallHit.Normal.Z) < MaxZComponent)
+        {
+            OutWallNormal = WallHit.Normal;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+FVector FRMCMoverSceneQuery::GetFloorNormal(int32 AgentIndex, const FRMCMovementSimState& State) const
+{
+    FHitResult FloorHit;
+    return TraceFloor(FloorHit, 10.0f) ? FVector(FloorHit.Normal) : FVector::UpVector;
+}
+
+bool FRMCMoverSceneQuery::IsMovingOnGround(int32 AgentIndex, const FRMCMovementSimState& State) const
+{
+    FHitResult FloorHit;
+    return TraceFloor(FloorHit, 10.0f);
+}
+
+float FRMCMoverSceneQuery::GetHeightAboveFloor() const
+{
+    FHitResult FloorHit;
+    if (TraceFloor(FloorHit, 10000.0f))
+    {
+        return FMath::Max(FloorHit.Distance - HalfHeight, 0.0f);
+    }
+
+    return UE_BIG_NUMBER;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FRMCMoverRules
+
+FRMCMovementParams FRMCMoverRules::MakeParams(const FMovementPhysicsProfile& Profile, float MaxWalkSpeed, float GravityZ)
+{
+    FRMCMovementParams Params;
+
+    Params.WallRunSpeed = Profile.WallRunSpeed;
+    Params.WallRunGravityScale = Profile.WallRunGravityScale;
+    Params.WallRunControlMultiplier = Profile.WallRunControlMultiplier;
+    Params.WallAttractionForce = Profile.WallAttractionForce;
+
+    Params.SlideSpeed = Profile.SlideSpeed;
+    Params.SlideFriction = Profile.SlideFriction;
+    Params.SlideMinSpeed = Profile.SlideMinSpeed;
+    Params.SlideDownhillAccelerationMultiplier = Profile.SlideDownhillAccelerationMultiplier;
+
+    Params.DashDistance = Profile.DashDistance;
+    Params.DashDuration = Profile.DashDuration;
+
+    Params.MaxMomentum = Profile.MaxMomentum;
+    Params.MomentumBuildRate = Profile.MomentumBuildRate;
+    Params.MomentumDecayRate = Profile.MomentumDecayRate;
+
+    Params.GlobalSpeedCap = Profile.GlobalSpeedCap;
+    Params.SpeedCapDamping = Profile.SpeedCapDamping;
+    Params.bApplySpeedCapToZVelocity = Profile.bApplySpeedCapToZVelocity;
+
+    Params.MaxWalkSpeed = MaxWalkSpeed;
+    Params.GravityZ = GravityZ;
+
+    return Params;
+}
+
+void FRMCMoverRules::UpdateBookkeeping(const FRMCMovementParams& Params, const FVector& Velocity, bool bOnGround, float DeltaSeconds,
+    FRMCMoverSyncState& InOutState)
+{
+    const float MomentumDelta = FRMCMovementSimulation::ComputeMomentumDelta(Params, Velocity, DeltaSeconds);
+    InOutState.Momentum = FRMCMovementSimulation::ApplyMomentumDelta(Params, InOutState.Momentum, MomentumDelta);
+
+    InOutState.DashCooldownRemaining = FMath::Max(InOutState.DashCooldownRemaining - DeltaSeconds, 0.0f);
+
+    if (bOnGround)
+    {
+        InOutState.bHasDoubleJumped = false;
+    }
+}
+
+FVector FRMCMoverRules::ComputeDashDirection(const FCharacterDefaultInputs* Inputs, const FMoverDefaultSyncState& SyncState)
+{
+    if (Inputs)
+    {
+        const FVector MoveInput = Inputs->GetMoveInput();
+        if (MoveInput.SizeSquared() > 0.1f)
+        {
+            return MoveInput.GetSafeNormal();
+        }
+    }
+
+    return SyncState.GetOrientation_WorldSpace().Vector().GetSafeNormal2D();
+}
+
+void FRMCMoverRules::MoveAndRecord(const FSimulationTickParams& Params, const FVector& Velocity, float DeltaSeconds, FMoverTickEndData& OutputState)
+{
+    FMoverDefaultSyncState& OutputSyncState = OutputState.SyncState.SyncStateCollection.FindOrAddMutableDataByType<FMoverDefaultSyncState>();
+
+    USceneComponent* UpdatedComponent = Params.MovingComps.UpdatedComponent.Get();
+    if (!UpdatedComponent)
+    {
+        return;
+    }
+
+    FMoveRecord MoveRecord;
+    MoveRecord.SetDeltaSeconds(DeltaSeconds);
+
+    const FVector MoveDelta = Velocity * DeltaSeconds;
+    const FQuat Rotation = UpdatedComponent->GetComponentQuat();
+
+    FHitResult Hit(1.0f);
+    UMovementUtils::TrySafeMoveUpdatedComponent(Params.MovingComps, MoveDelta, Rotation, true, Hit, ETeleportType::None, MoveRecord);
+
+    if (Hit.IsValidBlockingHit())
+    {
+        UMovementUtils::TryMoveToSlideAlongSurface(Params.MovingComps, MoveDelta, 1.0f - Hit.Time, Rotation, Hit.Normal, Hit, true, MoveRecord);
+    }
+
+    OutputSyncState.SetTransforms_WorldSpace(
+        UpdatedComponent->GetComponentLocation(),
+        UpdatedComponent->GetComponentRotation(),
+        MoveRecord.GetRelevantVelocity(),
+        nullptr);
+
+    OutputState.MovementEndState.RemainingMs = 0.0f;
+}
+
+FRMCMoverSyncState FRMCMoverRules::GetStartState(const FMoverTickStartData& StartState)
+{
+    const FRMCMoverSyncState* RMCState = StartState.SyncState.SyncStateCollection.FindDataByType<FRMCMoverSyncState>();
+    return RMCState ? *RMCState : FRMCMoverSyncState();
+}
+
+void FRMCMoverRules::AddMomentum(const FRMCMovementParams& Params, FRMCMoverSyncState& InOutState, float Amount)
+{
+    InOutState.Momentum = FRMCMovementSimulation::ApplyMomentumDelta(Params, InOutState.Momentum, Amount);
+}
+
+FRMCMoverSyncState& FRMCMoverRules::BeginStep(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
+{
+    FRMCMoverSyncState& OutState = OutputState.SyncState.SyncStateCollection.FindOrAddMutableDataByType<FRMCMoverSyncState>();
+    if (const FRMCMoverSyncState* InState = Params.StartState.SyncState.SyncStateCollection.FindDataByType<FRMCMoverSyncState>())
+    {
+        OutState = *InState;
+    }
+
+    return OutState;
+}
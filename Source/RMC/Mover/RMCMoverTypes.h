@@ -0,0 +1,167 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MoverTypes.h"
+#include "MoverDataModelTypes.h"
+#include "MoverSimulationTypes.h"
+#include "../Components/Movement/RMCMovementSimulation.h"
+#include "RMCMoverTypes.generated.h"
+
+struct FMovementPhysicsProfile;
+
+/**
+ * Mode names registered on URMCMoverComponent. Walking and Falling match the default Mover mode names.
+ */
+namespace RMCMoverModeNames
+{
+    RMC_API extern const FName Walking;
+    RMC_API extern const FName Falling;
+    RMC_API extern const FName WallRunning;
+    RMC_API extern const FName Sliding;
+    RMC_API extern const FName Dashing;
+}
+
+/**
+ * RMC ability input, produced alongside FCharacterDefaultInputs
+ */
+USTRUCT(BlueprintType)
+struct RMC_API FRMCMoverInputs : public FMoverDataStructBase
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "Mover")
+    bool bIsSlidePressed = false;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Mover")
+    bool bIsSlideJustPressed = false;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Mover")
+    bool bIsDashJustPressed = false;
+
+    virtual FMoverDataStructBase* Clone() const override;
+    virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+    virtual UScriptStruct* GetScriptStruct() const override { return StaticStruct(); }
+    virtual void ToString(FAnsiStringBuilderBase& Out) const override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FRMCMoverInputs> : public TStructOpsTypeTraitsBase2<FRMCMoverInputs>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithCopy = true
+    };
+};
+
+/**
+ * RMC state carried through the Mover simulation so it is predicted, reconciled and rolled back
+ * together with location and velocity
+ */
+USTRUCT(BlueprintType)
+struct RMC_API FRMCMoverSyncState : public FMoverDataStructBase
+{
+    GENERATED_BODY()
+
+    // Mode the RMC rules last initialized, used to detect entering a mode
+    UPROPERTY(BlueprintReadOnly, Category = "Mover")
+    uint8 ActiveMode = static_cast<uint8>(ERMCMovementSimMode::Walking);
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mover")
+    float Momentum = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mover")
+    bool bHasDoubleJumped = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mover")
+    FVector WallNormal = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mover")
+    FVector DashDirection = FVector::ZeroVector;
+
+    // Countdowns, advanced by the simulation step so they roll back with everything else
+    UPROPERTY(BlueprintReadOnly, Category = "Mover")
+    float DashTimeRemaining = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mover")
+    float DashCooldownRemaining = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mover")
+    float WallRunTimeRemaining = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mover")
+    float SlideTimeRemaining = 0.0f;
+
+    ERMCMovementSimMode GetActiveMode() const { return static_cast<ERMCMovementSimMode>(ActiveMode); }
+
+    virtual FMoverDataStructBase* Clone() const override;
+    virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+    virtual UScriptStruct* GetScriptStruct() const override { return StaticStruct(); }
+    virtual void ToString(FAnsiStringBuilderBase& Out) const override;
+    virtual bool ShouldReconcile(const FMoverDataStructBase& AuthorityState) const override;
+    virtual void Interpolate(const FMoverDataStructBase& From, const FMoverDataStructBase& To, float Pct) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FRMCMoverSyncState> : public TStructOpsTypeTraitsBase2<FRMCMoverSyncState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithCopy = true
+    };
+};
+
+/**
+ * Answers the simulation core's scene queries with world traces around the Mover's updated component
+ */
+class RMC_API FRMCMoverSceneQuery : public IRMCMovementSceneQuery
+{
+public:
+    FRMCMoverSceneQuery(const USceneComponent* InUpdatedComponent, const FVector& InLocation, float InMaxWallRunSurfaceAngle);
+
+    virtual bool FindWall(int32 AgentIndex, const FRMCMovementSimState& State, FVector& OutWallNormal) const override;
+    virtual FVector GetFloorNormal(int32 AgentIndex, const FRMCMovementSimState& State) const override;
+    virtual bool IsMovingOnGround(int32 AgentIndex, const FRMCMovementSimState& State) const override;
+
+    /** Height of the updated component above the floor, or a large value when nothing is below */
+    float GetHeightAboveFloor() const;
+
+private:
+    bool TraceFloor(FHitResult& OutHit, float Distance) const;
+
+    const USceneComponent* UpdatedComponent;
+    FVector Location;
+    float MaxWallRunSurfaceAngle;
+    float HalfHeight;
+};
+
+/**
+ * Glue between Mover's data model and the RMC rules shared with URMCMovementComponent
+ */
+struct RMC_API FRMCMoverRules
+{
+    /** Simulation parameters from a physics profile */
+    static FRMCMovementParams MakeParams(const FMovementPhysicsProfile& Profile, float MaxWalkSpeed, float GravityZ);
+
+    /** Momentum, cooldowns and the double jump reset, run once per simulation step in every mode */
+    static void UpdateBookkeeping(const FRMCMovementParams& Params, const FVector& Velocity, bool bOnGround, float DeltaSeconds,
+        FRMCMoverSyncState& InOutState);
+
+    /** Dash heads along the move input, or along the facing when there is none */
+    static FVector ComputeDashDirection(const FCharacterDefaultInputs* Inputs, const FMoverDefaultSyncState& SyncState);
+
+    /** Sweeps the updated component by Velocity * DeltaSeconds, sliding along what it hits, and records the result */
+    static void MoveAndRecord(const FSimulationTickParams& Params, const FVector& Velocity, float DeltaSeconds, FMoverTickEndData& OutputState);
+
+    /** RMC state a step starts from, or defaults before the first step */
+    static FRMCMoverSyncState GetStartState(const FMoverTickStartData& StartState);
+
+    /** Adds momentum from an action, clamped to the profile maximum */
+    static void AddMomentum(const FRMCMovementParams& Params, FRMCMoverSyncState& InOutState, float Amount);
+
+    /** Starting state for a step: the input RMC state, or defaults the first time */
+    static FRMCMoverSyncState& BeginStep(const FSimulationTickParams& Params, FMoverTickEndData& OutputState);
+};
@@ -0,0 +1,229 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCCharacterPoolSubsystem.h"
+#include "../RMCCharacter.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+URMCCharacterPoolSubsystem::URMCCharacterPoolSubsystem()
+{
+    NumAcquiredFromPool = 0;
+    NumSpawnedOnAcquire = 0;
+    NumReleased = 0;
+}
+
+void URMCCharacterPoolSubsystem::Deinitialize()
+{
+    Pools.Reset();
+
+    Super::Deinitialize();
+}
+
+bool URMCCharacterPoolSubsystem::CanPool() const
+{
+    return GetWorld()->GetNetMode() != NM_Client;
+}
+
+ARMCCharacter* URMCCharacterPoolSubsystem::SpawnCharacter(UClass* CharacterClass, const FTransform& Transform) const
+{
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_RMCCharacterPool_Spawn);
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    return GetWorld()->SpawnActor<ARMCCharacter>(CharacterClass, Transform, SpawnParams);
+}
+
+void URMCCharacterPoolSubsystem::Prewarm(TSubclassOf<ARMCCharacter> CharacterClass, int32 Count)
+{
+    if (!CharacterClass || !CanPool())
+    {
+        return;
+    }
+
+    FRMCCharacterPool& Pool = Pools.FindOrAdd(CharacterClass);
+    Pool.Characters.Reserve(Count);
+    while (Pool.Characters.Num() < Count)
+    {
+        ARMCCharacter* Character = SpawnCharacter(CharacterClass, FTransform::Identity);
+        if (!Character)
+        {
+            break;
+        }
+
+        Character->ResetForPool();
+        Pool.Characters.Add(Character);
+    }
+}
+
+ARMCCharacter* URMCCharacterPoolSubsystem::Acquire(TSubclassOf<ARMCCharacter> CharacterClass, const FTransform& Transform)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_RMCCharacterPool_Acquire);
+
+    if (!CharacterClass)
+    {
+        return nullptr;
+    }
+
+    if (FRMCCharacterPool* Pool = CanPool() ? Pools.Find(CharacterClass) : nullptr)
+    {
+        // Characters destroyed while pooled, e.g. by level streaming, are skipped
+        while (Pool->Characters.Num() > 0)
+        {
+            ARMCCharacter* Character = Pool->Characters.Pop(EAllowShrinking::No);
+            if (IsValid(Character))
+            {
+                Character->ActivateFromPool(Transform);
+                ++NumAcquiredFromPool;
+                return Character;
+            }
+        }
+    }
+
+    ++NumSpawnedOnAcquire;
+    return SpawnCharacter(CharacterClass, Transform);
+}
+
+void URMCCharacterPoolSubsystem::Release(ARMCCharacter* Character)
+{
+    if (!IsValid(Character) || Character->IsInPool())
+    {
+        return;
+    }
+
+    if (!CanPool())
+    {
+        Character->Destroy();
+        return;
+    }
+
+    Character->ResetForPool();
+    Pools.FindOrAdd(Character->GetClass()).Characters.Add(Character);
+    ++NumReleased;
+}
+
+int32 URMCCharacterPoolSubsystem::GetNumPooled(TSubclassOf<ARMCCharacter> CharacterClass) const
+{
+    const FRMCCharacterPool* Pool = Pools.Find(CharacterClass);
+    return Pool ? Pool->Characters.Num() : 0;
+}
+
+void URMCCharacterPoolSubsystem::LogStats() const
+{
+    for (const TPair<TObjectPtr<UClass>, FRMCCharacterPool>& Pair : Pools)
+    {
+        UE_LOG(LogTemp, Display, TEXT("RMC pool %s: %d idle"), *GetNameSafe(Pair.Key), Pair.Value.Characters.Num());
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("RMC pools: %d acquires served from a pool, %d spawned because a pool was empty, %d released"),
+        NumAcquiredFromPool, NumSpawnedOnAcquire, NumReleased);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Console commands
+
+namespace RMCCharacterPoolCommands
+{
+    /** The class named by an argument, otherwise the game mode's pawn class if it is an RMC character */
+    static UClass* ResolveCharacterClass(const TArray<FString>& Args, int32 ArgIndex, const UWorld* World)
+    {
+        if (Args.IsValidIndex(ArgIndex))
+        {
+            return LoadClass<ARMCCharacter>(nullptr, *Args[ArgIndex]);
+        }
+
+        const AGameModeBase* GameMode = World->GetAuthGameMode();
+        if (GameMode && GameMode->DefaultPawnClass && GameMode->DefaultPawnClass->IsChildOf<ARMCCharacter>())
+        {
+            return GameMode->DefaultPawnClass;
+        }
+
+        return ARMCCharacter::StaticClass();
+    }
+
+    static FAutoConsoleCommandWithWorldAndArgs PrewarmCommand(
+        TEXT("rmc.Pool.Prewarm"),
+        TEXT("Fills the character pool for a class. Usage: rmc.Pool.Prewarm [Count=16] [ClassPath]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            URMCCharacterPoolSubsystem* Pool = World ? World->GetSubsystem<URMCCharacterPoolSubsystem>() : nullptr;
+            UClass* CharacterClass = Pool ? ResolveCharacterClass(Args, 1, World) : nullptr;
+            if (!CharacterClass)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("rmc.Pool.Prewarm: no pool or character class"));
+                return;
+            }
+
+            Pool->Prewarm(CharacterClass, Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 16);
+            Pool->LogStats();
+        }));
+
+    static FAutoConsoleCommandWithWorldAndArgs StatsCommand(
+        TEXT("rmc.Pool.Stats"),
+        TEXT("Logs character pool sizes and how many acquires they served"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            if (const URMCCharacterPoolSubsystem* Pool = World ? World->GetSubsystem<URMCCharacterPoolSubsystem>() : nullptr)
+            {
+                Pool->LogStats();
+            }
+        }));
+
+    static FAutoConsoleCommandWithWorldAndArgs SpikeTestCommand(
+        TEXT("rmc.Pool.SpikeTest"),
+        TEXT("Brings in a wave of characters by spawning, then the same wave from the pool, and logs the time each took. ")
+        TEXT("Run under Insights to capture both spikes. Usage: rmc.Pool.SpikeTest [Count=16] [ClassPath]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            URMCCharacterPoolSubsystem* Pool = World ? World->GetSubsystem<URMCCharacterPoolSubsystem>() : nullptr;
+            UClass* CharacterClass = Pool ? ResolveCharacterClass(Args, 1, World) : nullptr;
+            if (!CharacterClass || World->GetNetMode() == NM_Client)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("rmc.Pool.SpikeTest: needs a server or standalone game and a character class"));
+                return;
+            }
+
+            const int32 Count = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 16;
+            Pool->Prewarm(CharacterClass, Count);
+
+            // Well away from the level so neither wave collides with it or with the other
+            const FVector Origin(0.0f, 0.0f, 100000.0f);
+            auto WaveTransform = [&Origin](int32 Index) { return FTransform(Origin + FVector(Index * 200.0f, 0.0f, 0.0f)); };
+
+            TArray<ARMCCharacter*> Spawned;
+            const double SpawnStart = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                FActorSpawnParameters SpawnParams;
+                SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+                Spawned.Add(World->SpawnActor<ARMCCharacter>(CharacterClass, WaveTransform(Index), SpawnParams));
+            }
+            const double SpawnSeconds = FPlatformTime::Seconds() - SpawnStart;
+
+            TArray<ARMCCharacter*> Acquired;
+            const double AcquireStart = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                Acquired.Add(Pool->Acquire(CharacterClass, WaveTransform(Index)));
+            }
+            const double AcquireSeconds = FPlatformTime::Seconds() - AcquireStart;
+
+            for (ARMCCharacter* Character : Spawned)
+            {
+                if (Character)
+                {
+                    Character->Destroy();
+                }
+            }
+
+            for (ARMCCharacter* Character : Acquired)
+            {
+                Pool->Release(Character);
+            }
+
+            UE_LOG(LogTemp, Display, TEXT("RMC pool spike test, %d x %s: spawning %.2f ms (%.3f ms each), pooled %.2f ms (%.3f ms each)"),
+                Count, *CharacterClass->GetName(), SpawnSeconds * 1000.0, SpawnSeconds * 1000.0 / Count, AcquireSeconds * 1000.0,
+                AcquireSeconds * 1000.0 / Count);
+        }));
+}
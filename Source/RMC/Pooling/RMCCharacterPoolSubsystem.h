@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RMCCharacterPoolSubsystem.generated.h"
+
+class ARMCCharacter;
+
+/**
+ * Idle characters of one class
+ */
+USTRUCT()
+struct FRMCCharacterPool
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<ARMCCharacter>> Characters;
+};
+
+/**
+ * Recycles RMC characters so waves don't pay for spawning them. Prewarm spawns characters during loading
+ * and parks them out of play; Acquire hands one back at a transform, and Release resets one and parks it
+ * again. Acquiring from a non-empty pool is a pop and ARMCCharacter::ActivateFromPool, with no
+ * construction, component registration or BeginPlay.
+ *
+ * Characters replicate, so pools only exist where they are spawned: on servers and in standalone games.
+ */
+UCLASS()
+class RMC_API URMCCharacterPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    URMCCharacterPoolSubsystem();
+
+    virtual void Deinitialize() override;
+
+    /** Spawns characters into the pool for a class until it holds Count */
+    void Prewarm(TSubclassOf<ARMCCharacter> CharacterClass, int32 Count);
+
+    /** An active character of the class at Transform, from the pool if it has one, otherwise newly spawned */
+    ARMCCharacter* Acquire(TSubclassOf<ARMCCharacter> CharacterClass, const FTransform& Transform);
+
+    /** Takes a character out of play and parks it in its class's pool */
+    void Release(ARMCCharacter* Character);
+
+    /** Idle characters pooled for a class */
+    int32 GetNumPooled(TSubclassOf<ARMCCharacter> CharacterClass) const;
+
+    /** Logs pool sizes and how many acquires the pools served */
+    void LogStats() const;
+
+private:
+    /** Spawns a character of the class, active at Transform */
+    ARMCCharacter* SpawnCharacter(UClass* CharacterClass, const FTransform& Transform) const;
+
+    bool CanPool() const;
+
+    UPROPERTY()
+    TMap<TObjectPtr<UClass>, FRMCCharacterPool> Pools;
+
+    int32 NumAcquiredFromPool;
+    int32 NumSpawnedOnAcquire;
+    int32 NumReleased;
+};
@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCAICharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+ARMCAICharacter::ARMCAICharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer
+		.DoNotCreateDefaultSubobject(ARMCCharacter::CameraBoomComponentName)
+		.DoNotCreateDefaultSubobject(ARMCCharacter::FollowCameraComponentName))
+{
+	// Tick only moves the camera and draws debug
+	PrimaryActorTick.bCanEverTick = false;
+
+	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
+
+	// Nobody looks through its eyes, so animation only has to keep up while it is on screen
+	GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Console commands
+
+namespace RMCAICharacterCommands
+{
+	struct FVariantCost
+	{
+		int32 Components = 0;
+		int32 TickFunctions = 0;
+		int64 ObjectBytes = 0;
+		int64 ResourceBytes = 0;
+		double TickSeconds = 0.0;
+	};
+
+	/** Footprint of one character and its components, and the time its actor Tick takes */
+	static FVariantCost MeasureCharacter(ARMCCharacter* Character, int32 TickIterations)
+	{
+		FVariantCost Cost;
+
+		TInlineComponentArray<UActorComponent*> Components(Character);
+		Cost.Components = Components.Num();
+		Cost.ObjectBytes = Character->GetClass()->GetStructureSize();
+		Cost.ResourceBytes = Character->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+		Cost.TickFunctions = Character->IsActorTickEnabled() ? 1 : 0;
+
+		for (UActorComponent* Component : Components)
+		{
+			Cost.ObjectBytes += Component->GetClass()->GetStructureSize();
+			Cost.ResourceBytes += Component->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+			Cost.TickFunctions += Component->IsComponentTickEnabled() ? 1 : 0;
+		}
+
+		// Component ticks are the same for both variants; the actor tick is what differs
+		if (Character->PrimaryActorTick.bCanEverTick && Character->IsActorTickEnabled())
+		{
+			const double Start = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < TickIterations; ++Iteration)
+			{
+				Character->Tick(1.0f / 60.0f);
+			}
+			Cost.TickSeconds = (FPlatformTime::Seconds() - Start) / TickIterations;
+		}
+
+		return Cost;
+	}
+
+	/** Spawns Count characters of a class out of the way, averages their costs and destroys them */
+	static FVariantCost MeasureVariant(UWorld* World, UClass* CharacterClass, int32 Count)
+	{
+		FVariantCost Total;
+		const int32 TickIterations = 100;
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			const FVector Location(Index * 200.0f, 0.0f, 100000.0f);
+			ARMCCharacter* Character = World->SpawnActor<ARMCCharacter>(CharacterClass, FTransform(Location), SpawnParams);
+			if (!Character)
+			{
+				continue;
+			}
+
+			const FVariantCost Cost = MeasureCharacter(Character, TickIterations);
+			Total.Components += Cost.Components;
+			Total.TickFunctions += Cost.TickFunctions;
+			Total.ObjectBytes += Cost.ObjectBytes;
+			Total.ResourceBytes += Cost.ResourceBytes;
+			Total.TickSeconds += Cost.TickSeconds;
+
+			Character->Destroy();
+		}
+
+		FVariantCost Average;
+		Average.Components = Total.Components / Count;
+		Average.TickFunctions = Total.TickFunctions / Count;
+		Average.ObjectBytes = Total.ObjectBytes / Count;
+		Average.ResourceBytes = Total.ResourceBytes / Count;
+		Average.TickSeconds = Total.TickSeconds / Count;
+		return Average;
+	}
+
+	static void LogVariantCost(const UClass* CharacterClass, const FVariantCost& Cost)
+	{
+		UE_LOG(LogTemp, Display, TEXT("  %s: %d components, %d tick functions, %.1f KB objects, %.1f KB resources, actor tick %.2f us"),
+			*CharacterClass->GetName(), Cost.Components, Cost.TickFunctions, Cost.ObjectBytes / 1024.0, Cost.ResourceBytes / 1024.0,
+			Cost.TickSeconds * 1000000.0);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs CompareCommand(
+		TEXT("rmc.Character.CompareVariants"),
+		TEXT("Spawns player and AI RMC characters and logs each variant's per-instance footprint and actor tick cost. ")
+		TEXT("Usage: rmc.Character.CompareVariants [Count=16] [PlayerClassPath] [AIClassPath]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World)
+			{
+				return;
+			}
+
+			const int32 Count = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 16;
+
+			// The game mode's pawn stands in for the player variant when no class is given
+			UClass* PlayerClass = Args.IsValidIndex(1) ? LoadClass<ARMCCharacter>(nullptr, *Args[1]) : nullptr;
+			if (!PlayerClass)
+			{
+				const AGameModeBase* GameMode = World->GetAuthGameMode();
+				const bool bRMCPawn = GameMode && GameMode->DefaultPawnClass && GameMode->DefaultPawnClass->IsChildOf<ARMCCharacter>();
+				PlayerClass = bRMCPawn ? GameMode->DefaultPawnClass.Get() : ARMCCharacter::StaticClass();
+			}
+
+			UClass* AIClass = Args.IsValidIndex(2) ? LoadClass<ARMCAICharacter>(nullptr, *Args[2]) : nullptr;
+			if (!AIClass)
+			{
+				AIClass = ARMCAICharacter::StaticClass();
+			}
+
+			UE_LOG(LogTemp, Display, TEXT("RMC character variants, averaged over %d each:"), Count);
+			LogVariantCost(PlayerClass, MeasureVariant(World, PlayerClass, Count));
+			LogVariantCost(AIClass, MeasureVariant(World, AIClass, Count));
+		}));
+}
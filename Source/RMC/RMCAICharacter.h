@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RMCCharacter.h"
+#include "RMCAICharacter.generated.h"
+
+/**
+ * RMC character for AI. Moves exactly like ARMCCharacter but is built without the camera boom and follow
+ * camera, and without an actor tick, since Tick only moves the camera and draws debug. Input bindings are
+ * never set up for it, as no player possesses it.
+ */
+UCLASS(Blueprintable, BlueprintType, meta=(ShortTooltip="AI character with momentum-based movement and no camera."))
+class RMC_API ARMCAICharacter : public ARMCCharacter
+{
+	GENERATED_BODY()
+
+public:
+	ARMCAICharacter(const FObjectInitializer& ObjectInitializer);
+};
@@ -4,11 +4,20 @@
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/InputComponent.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/Controller.h"
+#include "GameFramework/PlayerController.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/GameplayStatics.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Components/Movement/RMCMovementComponent.h"
+#include "LagCompensation/RMCLagCompensationComponent.h"
+#include "Significance/RMCSignificanceSubsystem.h"
+
+FName ARMCCharacter::CameraBoomComponentName(TEXT("CameraBoom"));
+FName ARMCCharacter::FollowCameraComponentName(TEXT("FollowCamera"));
 
 // Sets default values
 ARMCCharacter::ARMCCharacter(const FObjectInitializer& ObjectInitializer)
@@ -78,16 +87,33 @@ ARMCCharacter::ARMCCharacter(const FObjectInitializer& ObjectInitializer)
 		MovementComponent->MomentumBuildRate = 10.0f;
 	}
 
-	// Create a camera boom (pulls in towards the player if there is a collision)
-	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
-	CameraBoom->SetupAttachment(RootComponent);
-	CameraBoom->TargetArmLength = 300.0f; // The camera follows at this distance behind the character	
-	CameraBoom->bUsePawnControlRotation = true; // Rotate the arm based on the controller
+	// Create a camera boom (pulls in towards the player if there is a collision).
+	// The camera is optional so variants nobody views through, like ARMCAICharacter, can leave it out.
+	CameraBoom = CreateOptionalDefaultSubobject<USpringArmComponent>(CameraBoomComponentName);
+	if (CameraBoom)
+	{
+		CameraBoom->SetupAttachment(RootComponent);
+		CameraBoom->TargetArmLength = 300.0f; // The camera follows at this distance behind the character
+		CameraBoom->bUsePawnControlRotation = true; // Rotate the arm based on the controller
+	}
 
 	// Create a follow camera
-	FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
-	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName); // Attach the camera to the end of the boom
-	FollowCamera->bUsePawnControlRotation = false; // Camera does not rotate relative to arm
+	FollowCamera = CreateOptionalDefaultSubobject<UCameraComponent>(FollowCameraComponentName);
+	if (FollowCamera)
+	{
+		if (CameraBoom)
+		{
+			FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName); // Attach the camera to the end of the boom
+		}
+		else
+		{
+			FollowCamera->SetupAttachment(RootComponent);
+		}
+		FollowCamera->bUsePawnControlRotation = false; // Camera does not rotate relative to arm
+	}
+
+	// Record capsule history on servers for rewound hit validation
+	LagCompensation = CreateDefaultSubobject<URMCLagCompensationComponent>(TEXT("LagCompensation"));
 
 	// Initialize movement input values
 	ForwardInputValue = 0.0f;
@@ -96,6 +122,27 @@ ARMCCharacter::ARMCCharacter(const FObjectInitializer& ObjectInitializer)
 	// Initialize animation properties
 	bIsWallRunningLeft = false;
 	bIsWallRunningRight = false;
+
+	// Assume every movement event is overridden until BeginPlay knows better
+	bScriptWallRunBegin = true;
+	bScriptWallRunEnd = true;
+	bScriptSlideBegin = true;
+	bScriptSlideEnd = true;
+	bScriptDashBegin = true;
+	bScriptDashEnd = true;
+	bScriptDoubleJump = true;
+	bScriptMomentumChanged = true;
+	bScriptTick = true;
+
+	bRollbackControlled = false;
+	bApplyingRollbackInput = false;
+	bResimulatingRollback = false;
+	PendingRollbackButtons = 0;
+
+	bInPool = false;
+
+	bCameraAtDefault = true;
+	LocalViewerCount = 0;
 }
 
 // Called when the game starts or when spawned
@@ -104,25 +151,72 @@ void ARMCCharacter::BeginPlay()
 	Super::BeginPlay();
 
 	// Store default camera values
-	DefaultCameraBoomLength = CameraBoom->TargetArmLength;
-	DefaultCameraLocation = FollowCamera->GetRelativeLocation();
-	DefaultCameraRotation = FollowCamera->GetRelativeRotation();
+	DefaultCameraBoomLength = CameraBoom ? CameraBoom->TargetArmLength : 0.0f;
+	DefaultCameraLocation = FollowCamera ? FollowCamera->GetRelativeLocation() : FVector::ZeroVector;
+	DefaultCameraRotation = FollowCamera ? FollowCamera->GetRelativeRotation() : FRotator::ZeroRotator;
+
+	CacheScriptEventImplementations();
+
+	BindMovementEvents();
+
+	// Set up wall run check timer
+	GetWorldTimerManager().SetTimer(TimerHandle_CheckWallRun, this, &ARMCCharacter::TryWallRun, 0.1f, true);
+
+	// Montages still tick for root motion on a dedicated server; hit validation uses the capsule, not bones
+	if (IsNetMode(NM_DedicatedServer))
+	{
+		GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	}
+
+	if (URMCSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<URMCSignificanceSubsystem>())
+	{
+		Significance->RegisterCharacter(this);
+	}
+}
+
+void ARMCCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (URMCSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<URMCSignificanceSubsystem>())
+	{
+		Significance->UnregisterCharacter(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ARMCCharacter::BecomeViewTarget(APlayerController* PC)
+{
+	Super::BecomeViewTarget(PC);
+
+	if (PC && PC->IsLocalController())
+	{
+		++LocalViewerCount;
+	}
+}
+
+void ARMCCharacter::EndViewTarget(APlayerController* PC)
+{
+	if (PC && PC->IsLocalController() && LocalViewerCount > 0)
+	{
+		--LocalViewerCount;
+	}
+
+	Super::EndViewTarget(PC);
+}
 
-	// Bind to movement component events
+void ARMCCharacter::BindMovementEvents()
+{
 	URMCMovementComponent* MovementComponent = GetRMCMovementComponent();
 	if (MovementComponent)
 	{
-		MovementComponent->OnWallRunBegin.AddDynamic(this, &ARMCCharacter::HandleWallRunBegin);
-		MovementComponent->OnWallRunEnd.AddDynamic(this, &ARMCCharacter::HandleWallRunEnd);
-		MovementComponent->OnSlideBegin.AddDynamic(this, &ARMCCharacter::HandleSlideBegin);
-		MovementComponent->OnSlideEnd.AddDynamic(this, &ARMCCharacter::HandleSlideEnd);
-		MovementComponent->OnDashBegin.AddDynamic(this, &ARMCCharacter::HandleDashBegin);
-		MovementComponent->OnDashEnd.AddDynamic(this, &ARMCCharacter::HandleDashEnd);
-		MovementComponent->OnMomentumChanged.AddDynamic(this, &ARMCCharacter::HandleMomentumChanged);
+		MovementComponent->OnWallRunBeginNative.AddUObject(this, &ARMCCharacter::HandleWallRunBegin);
+		MovementComponent->OnWallRunEndNative.AddUObject(this, &ARMCCharacter::HandleWallRunEnd);
+		MovementComponent->OnSlideBeginNative.AddUObject(this, &ARMCCharacter::HandleSlideBegin);
+		MovementComponent->OnSlideEndNative.AddUObject(this, &ARMCCharacter::HandleSlideEnd);
+		MovementComponent->OnDashBeginNative.AddUObject(this, &ARMCCharacter::HandleDashBegin);
+		MovementComponent->OnDashEndNative.AddUObject(this, &ARMCCharacter::HandleDashEnd);
+		MovementComponent->OnMomentumChangedNative.AddUObject(this, &ARMCCharacter::HandleMomentumChanged);
 	}
-
-	// Set up wall run check timer
-	GetWorldTimerManager().SetTimer(TimerHandle_CheckWallRun, this, &ARMCCharacter::TryWallRun, 0.1f, true);
 }
 
 // Called every frame
@@ -130,9 +224,16 @@ void ARMCCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// Update camera based on movement state
+	// Blueprint Event Tick has run. The rest moves the camera and draws debug, which a dedicated server has neither of.
+	if (IsNetMode(NM_DedicatedServer))
+	{
+		return;
+	}
+
+	// Update camera based on movement state. Only seen by a local player viewing through this
+	// character, and once back at its default pose there is nothing to do until the next wall run or slide.
 	URMCMovementComponent* MovementComponent = GetRMCMovementComponent();
-	if (MovementComponent)
+	if (FollowCamera && MovementComponent && IsLocallyViewed())
 	{
 		if (MovementComponent->bIsWallRunning)
 		{
@@ -142,7 +243,7 @@ void ARMCCharacter::Tick(float DeltaTime)
 		{
 			UpdateCameraDuringSlide(DeltaTime);
 		}
-		else
+		else if (!bCameraAtDefault)
 		{
 			ResetCameraToDefault(DeltaTime);
 		}
@@ -188,7 +289,8 @@ void ARMCCharacter::MoveForward(float Value)
 {
 	ForwardInputValue = Value;
 
-	if ((Controller != nullptr) && (Value != 0.0f))
+	// Rollback frames take movement from SampleRollbackInput instead
+	if ((Controller != nullptr) && (Value != 0.0f) && !bRollbackControlled)
 	{
 		// Find out which way is forward
 		const FRotator Rotation = Controller->GetControlRotation();
@@ -204,7 +306,7 @@ void ARMCCharacter::MoveRight(float Value)
 {
 	RightInputValue = Value;
 
-	if ((Controller != nullptr) && (Value != 0.0f))
+	if ((Controller != nullptr) && (Value != 0.0f) && !bRollbackControlled)
 	{
 		// Find out which way is right
 		const FRotator Rotation = Controller->GetControlRotation();
@@ -241,6 +343,11 @@ void ARMCCharacter::LookUpAtRate(float Rate)
 
 void ARMCCharacter::OnJumpActionPressed()
 {
+	if (RecordRollbackButton(ERMCRollbackButtons::JumpPressed))
+	{
+		return;
+	}
+
 	URMCMovementComponent* MovementComponent = GetRMCMovementComponent();
 	if (MovementComponent)
 	{
@@ -253,8 +360,18 @@ void ARMCCharacter::OnJumpActionPressed()
 		else if (MovementComponent->IsFalling() && MovementComponent->CanDoubleJump())
 		{
 			MovementComponent->PerformDoubleJump();
-			// Call blueprint native event
-			OnDoubleJump();
+			// Call blueprint native event, once per real double jump rather than per resimulation
+			if (!bResimulatingRollback)
+			{
+				if (bScriptDoubleJump)
+				{
+					OnDoubleJump();
+				}
+				else
+				{
+					OnDoubleJump_Implementation();
+				}
+			}
 		}
 		// Otherwise, normal jump
 		else
@@ -270,11 +387,21 @@ void ARMCCharacter::OnJumpActionPressed()
 
 void ARMCCharacter::OnJumpActionReleased()
 {
+	if (RecordRollbackButton(ERMCRollbackButtons::JumpReleased))
+	{
+		return;
+	}
+
 	StopJumping();
 }
 
 void ARMCCharacter::OnDashActionPressed()
 {
+	if (RecordRollbackButton(ERMCRollbackButtons::DashPressed))
+	{
+		return;
+	}
+
 	URMCMovementComponent* MovementComponent = GetRMCMovementComponent();
 	if (MovementComponent && MovementComponent->CanDash())
 	{
@@ -284,6 +411,11 @@ void ARMCCharacter::OnDashActionPressed()
 
 void ARMCCharacter::OnSlideActionPressed()
 {
+	if (RecordRollbackButton(ERMCRollbackButtons::SlidePressed))
+	{
+		return;
+	}
+
 	URMCMovementComponent* MovementComponent = GetRMCMovementComponent();
 	if (MovementComponent && MovementComponent->CanSlide())
 	{
@@ -293,6 +425,11 @@ void ARMCCharacter::OnSlideActionPressed()
 
 void ARMCCharacter::OnSlideActionReleased()
 {
+	if (RecordRollbackButton(ERMCRollbackButtons::SlideReleased))
+	{
+		return;
+	}
+
 	URMCMovementComponent* MovementComponent = GetRMCMovementComponent();
 	if (MovementComponent && MovementComponent->bIsSliding)
 	{
@@ -313,6 +450,12 @@ void ARMCCharacter::TryWallRun()
 	{
 		return;
 	}
+
+	// Proxies and replay playback take wall runs from the server instead of starting their own
+	if (GetLocalRole() == ROLE_SimulatedProxy && !bRollbackControlled)
+	{
+		return;
+	}
 	
 	// Check if we're in a state where wall running is possible
 	if (MovementComponent->IsFalling() && !MovementComponent->bIsSliding && !MovementComponent->bIsDashing)
@@ -331,6 +474,251 @@ void ARMCCharacter::TryWallRun()
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Replication
+
+void ARMCCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	Params.Condition = COND_SkipOwner;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ARMCCharacter, bIsWallRunningLeft, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ARMCCharacter, bIsWallRunningRight, Params);
+}
+
+void ARMCCharacter::SetWallRunSide(bool bLeft, bool bRight)
+{
+	if (bIsWallRunningLeft != bLeft)
+	{
+		bIsWallRunningLeft = bLeft;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ARMCCharacter, bIsWallRunningLeft, this);
+	}
+
+	if (bIsWallRunningRight != bRight)
+	{
+		bIsWallRunningRight = bRight;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ARMCCharacter, bIsWallRunningRight, this);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Movement LOD
+
+void ARMCCharacter::SetMovementLOD(ERMCMovementLOD NewLOD)
+{
+	URMCMovementComponent* MovementComponent = GetRMCMovementComponent();
+	if (!MovementComponent || MovementComponent->GetMovementLOD() == NewLOD)
+	{
+		return;
+	}
+
+	MovementComponent->SetMovementLOD(NewLOD);
+
+	// Tick only moves the camera and draws debug, so a dormant character doesn't need it
+	// unless Blueprint does its own work in Event Tick
+	if (!bScriptTick)
+	{
+		SetActorTickEnabled(NewLOD != ERMCMovementLOD::Dormant);
+	}
+
+	// Distant characters finish wall runs they are on but don't look for new ones
+	const bool bCheckWallRuns = NewLOD < ERMCMovementLOD::Minimal && !bRollbackControlled;
+	if (!bCheckWallRuns)
+	{
+		GetWorldTimerManager().ClearTimer(TimerHandle_CheckWallRun);
+	}
+	else if (!GetWorldTimerManager().IsTimerActive(TimerHandle_CheckWallRun))
+	{
+		GetWorldTimerManager().SetTimer(TimerHandle_CheckWallRun, this, &ARMCCharacter::TryWallRun, 0.1f, true);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Pooling
+
+void ARMCCharacter::ResetForPool()
+{
+	if (URMCSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<URMCSignificanceSubsystem>())
+	{
+		Significance->UnregisterCharacter(this);
+	}
+
+	SetRollbackControlled(false);
+	GetWorldTimerManager().ClearTimer(TimerHandle_CheckWallRun);
+
+	// AI controllers go with the character's last use; players keep theirs
+	if (AController* OldController = GetController())
+	{
+		OldController->UnPossess();
+		if (!OldController->IsA<APlayerController>())
+		{
+			OldController->Destroy();
+		}
+	}
+
+	if (URMCMovementComponent* MovementComponent = GetRMCMovementComponent())
+	{
+		MovementComponent->ResetMovementState();
+		MovementComponent->RemoveExternalEventBindings();
+		BindMovementEvents();
+		MovementComponent->SetComponentTickEnabled(false);
+	}
+
+	LagCompensation->SetRecording(false);
+
+	// Input, animation flags and camera as BeginPlay found them
+	ForwardInputValue = 0.0f;
+	RightInputValue = 0.0f;
+	SetWallRunSide(false, false);
+	if (CameraBoom)
+	{
+		CameraBoom->TargetArmLength = DefaultCameraBoomLength;
+	}
+	if (FollowCamera)
+	{
+		FollowCamera->SetRelativeLocationAndRotation(DefaultCameraLocation, DefaultCameraRotation);
+	}
+	bCameraAtDefault = true;
+
+	StopAnimMontage();
+	GetMesh()->SetComponentTickEnabled(false);
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+
+	bInPool = true;
+	ForceNetUpdate();
+}
+
+void ARMCCharacter::ActivateFromPool(const FTransform& Transform)
+{
+	bInPool = false;
+
+	SetActorLocationAndRotation(Transform.GetLocation(), Transform.Rotator(), false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+	GetMesh()->SetComponentTickEnabled(true);
+
+	if (URMCMovementComponent* MovementComponent = GetRMCMovementComponent())
+	{
+		MovementComponent->SetComponentTickEnabled(true);
+		MovementComponent->SetDefaultMovementMode();
+		MovementComponent->BroadcastMomentumChanged(true);
+	}
+
+	LagCompensation->SetRecording(true);
+	GetWorldTimerManager().SetTimer(TimerHandle_CheckWallRun, this, &ARMCCharacter::TryWallRun, 0.1f, true);
+
+	if (URMCSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<URMCSignificanceSubsystem>())
+	{
+		Significance->RegisterCharacter(this);
+	}
+
+	// As spawning would have, for classes that AI possesses on spawn
+	if (!GetController() && (AutoPossessAI == EAutoPossessAI::Spawned || AutoPossessAI == EAutoPossessAI::PlacedInWorldOrSpawned))
+	{
+		SpawnDefaultController();
+	}
+
+	ForceNetUpdate();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Rollback
+
+void ARMCCharacter::SetRollbackControlled(bool bEnabled)
+{
+	if (bRollbackControlled == bEnabled)
+	{
+		return;
+	}
+
+	bRollbackControlled = bEnabled;
+	PendingRollbackButtons = 0;
+
+	// Every peer simulates this character itself, so movement must neither tick nor replicate on its own
+	if (URMCMovementComponent* MovementComponent = GetRMCMovementComponent())
+	{
+		MovementComponent->SetComponentTickEnabled(!bEnabled);
+	}
+
+	if (HasAuthority())
+	{
+		SetReplicatingMovement(!bEnabled);
+	}
+
+	// Wall run checks run inside the rollback step instead of on a timer
+	if (bEnabled)
+	{
+		GetWorldTimerManager().ClearTimer(TimerHandle_CheckWallRun);
+	}
+	else
+	{
+		GetWorldTimerManager().SetTimer(TimerHandle_CheckWallRun, this, &ARMCCharacter::TryWallRun, 0.1f, true);
+	}
+}
+
+bool ARMCCharacter::RecordRollbackButton(uint8 Button)
+{
+	if (!bRollbackControlled || bApplyingRollbackInput)
+	{
+		return false;
+	}
+
+	PendingRollbackButtons |= Button;
+	return true;
+}
+
+FRMCRollbackInput ARMCCharacter::SampleRollbackInput()
+{
+	FVector MoveInput = FVector::ZeroVector;
+	if (Controller)
+	{
+		const FRotator YawRotation(0, Controller->GetControlRotation().Yaw, 0);
+		const FRotationMatrix YawMatrix(YawRotation);
+		MoveInput = YawMatrix.GetUnitAxis(EAxis::X) * ForwardInputValue + YawMatrix.GetUnitAxis(EAxis::Y) * RightInputValue;
+	}
+
+	const FRMCRollbackInput Input = FRMCRollbackInput::Make(MoveInput, PendingRollbackButtons);
+	PendingRollbackButtons = 0;
+	return Input;
+}
+
+void ARMCCharacter::ApplyRollbackInput(const FRMCRollbackInput& Input, bool bResimulating)
+{
+	// Let the action handlers run for real instead of recording the press again
+	bApplyingRollbackInput = true;
+	bResimulatingRollback = bResimulating;
+
+	if (Input.Buttons & ERMCRollbackButtons::JumpPressed)
+	{
+		OnJumpActionPressed();
+	}
+	if (Input.Buttons & ERMCRollbackButtons::JumpReleased)
+	{
+		OnJumpActionReleased();
+	}
+	if (Input.Buttons & ERMCRollbackButtons::DashPressed)
+	{
+		OnDashActionPressed();
+	}
+	if (Input.Buttons & ERMCRollbackButtons::SlidePressed)
+	{
+		OnSlideActionPressed();
+	}
+	if (Input.Buttons & ERMCRollbackButtons::SlideReleased)
+	{
+		OnSlideActionReleased();
+	}
+
+	bApplyingRollbackInput = false;
+	bResimulatingRollback = false;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Movement component event handlers
 
@@ -340,11 +728,17 @@ void ARMCCharacter::HandleWallRunBegin(const FVector& WallNormal)
 	FVector Right = GetActorRightVector();
 	float DotProduct = FVector::DotProduct(Right, WallNormal);
 
-	bIsWallRunningLeft = DotProduct > 0;
-	bIsWallRunningRight = DotProduct < 0;
+	SetWallRunSide(DotProduct > 0, DotProduct < 0);
 
 	// Call blueprint native event
-	OnWallRunBegin(WallNormal);
+	if (bScriptWallRunBegin)
+	{
+		OnWallRunBegin(WallNormal);
+	}
+	else
+	{
+		OnWallRunBegin_Implementation(WallNormal);
+	}
 }
 
 void ARMCCharacter::OnWallRunBegin_Implementation(const FVector& WallNormal)
@@ -354,11 +748,17 @@ void ARMCCharacter::OnWallRunBegin_Implementation(const FVector& WallNormal)
 
 void ARMCCharacter::HandleWallRunEnd()
 {
-	bIsWallRunningLeft = false;
-	bIsWallRunningRight = false;
+	SetWallRunSide(false, false);
 
 	// Call blueprint native event
-	OnWallRunEnd();
+	if (bScriptWallRunEnd)
+	{
+		OnWallRunEnd();
+	}
+	else
+	{
+		OnWallRunEnd_Implementation();
+	}
 }
 
 void ARMCCharacter::OnWallRunEnd_Implementation()
@@ -369,7 +769,14 @@ void ARMCCharacter::OnWallRunEnd_Implementation()
 void ARMCCharacter::HandleSlideBegin()
 {
 	// Call blueprint native event
-	OnSlideBegin();
+	if (bScriptSlideBegin)
+	{
+		OnSlideBegin();
+	}
+	else
+	{
+		OnSlideBegin_Implementation();
+	}
 }
 
 void ARMCCharacter::OnSlideBegin_Implementation()
@@ -380,7 +787,14 @@ void ARMCCharacter::OnSlideBegin_Implementation()
 void ARMCCharacter::HandleSlideEnd()
 {
 	// Call blueprint native event
-	OnSlideEnd();
+	if (bScriptSlideEnd)
+	{
+		OnSlideEnd();
+	}
+	else
+	{
+		OnSlideEnd_Implementation();
+	}
 }
 
 void ARMCCharacter::OnSlideEnd_Implementation()
@@ -391,7 +805,14 @@ void ARMCCharacter::OnSlideEnd_Implementation()
 void ARMCCharacter::HandleDashBegin(const FVector& DashDirection)
 {
 	// Call blueprint native event
-	OnDashBegin(DashDirection);
+	if (bScriptDashBegin)
+	{
+		OnDashBegin(DashDirection);
+	}
+	else
+	{
+		OnDashBegin_Implementation(DashDirection);
+	}
 }
 
 void ARMCCharacter::OnDashBegin_Implementation(const FVector& DashDirection)
@@ -402,7 +823,14 @@ void ARMCCharacter::OnDashBegin_Implementation(const FVector& DashDirection)
 void ARMCCharacter::HandleDashEnd()
 {
 	// Call blueprint native event
-	OnDashEnd();
+	if (bScriptDashEnd)
+	{
+		OnDashEnd();
+	}
+	else
+	{
+		OnDashEnd_Implementation();
+	}
 }
 
 void ARMCCharacter::OnDashEnd_Implementation()
@@ -413,7 +841,14 @@ void ARMCCharacter::OnDashEnd_Implementation()
 void ARMCCharacter::HandleMomentumChanged(float NewMomentum)
 {
 	// Call blueprint native event
-	OnMomentumChanged(NewMomentum);
+	if (bScriptMomentumChanged)
+	{
+		OnMomentumChanged(NewMomentum);
+	}
+	else
+	{
+		OnMomentumChanged_Implementation(NewMomentum);
+	}
 }
 
 void ARMCCharacter::OnMomentumChanged_Implementation(float NewMomentum)
@@ -426,11 +861,31 @@ void ARMCCharacter::OnDoubleJump_Implementation()
 	// Default implementation - can be overridden in Blueprints
 }
 
+void ARMCCharacter::CacheScriptEventImplementations()
+{
+	const UClass* Class = GetClass();
+	bScriptWallRunBegin = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ARMCCharacter, OnWallRunBegin));
+	bScriptWallRunEnd = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ARMCCharacter, OnWallRunEnd));
+	bScriptSlideBegin = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ARMCCharacter, OnSlideBegin));
+	bScriptSlideEnd = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ARMCCharacter, OnSlideEnd));
+	bScriptDashBegin = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ARMCCharacter, OnDashBegin));
+	bScriptDashEnd = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ARMCCharacter, OnDashEnd));
+	bScriptDoubleJump = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ARMCCharacter, OnDoubleJump));
+	bScriptMomentumChanged = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ARMCCharacter, OnMomentumChanged));
+	bScriptTick = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ARMCCharacter, ReceiveTick));
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Debug Helper Functions
 
 void ARMCCharacter::ToggleDebugMode()
 {
+    // Nothing is drawn on a dedicated server, so don't build debug strings there
+    if (IsNetMode(NM_DedicatedServer))
+    {
+        return;
+    }
+
     bDebugModeEnabled = !bDebugModeEnabled;
     
     if (bDebugModeEnabled)
@@ -552,46 +1007,63 @@ void ARMCCharacter::DrawDebugHelpers(float Duration)
 
 void ARMCCharacter::UpdateCameraDuringWallRun(float DeltaTime)
 {
-	if (bIsWallRunningLeft || bIsWallRunningRight)
+	if (FollowCamera && (bIsWallRunningLeft || bIsWallRunningRight))
 	{
 		// Calculate target roll based on which side we're wall running on
-		float TargetRoll = bIsWallRunningLeft ? -WallRunCameraTilt : WallRunCameraTilt;
-		
+		const float TargetRoll = bIsWallRunningLeft ? -WallRunCameraTilt : WallRunCameraTilt;
+
 		// Smoothly interpolate to the target roll
-		FRotator CurrentRotation = FollowCamera->GetRelativeRotation();
-		FRotator TargetRotation = FRotator(CurrentRotation.Pitch, CurrentRotation.Yaw, TargetRoll);
-		FRotator NewRotation = FMath::RInterpTo(CurrentRotation, TargetRotation, DeltaTime, WallRunCameraTiltSpeed);
-		
-		FollowCamera->SetRelativeRotation(NewRotation);
+		const FRotator CurrentRotation = FollowCamera->GetRelativeRotation();
+		InterpCameraTo(FollowCamera->GetRelativeLocation(), FRotator(CurrentRotation.Pitch, CurrentRotation.Yaw, TargetRoll), DeltaTime);
+		bCameraAtDefault = false;
 	}
 }
 
 void ARMCCharacter::UpdateCameraDuringSlide(float DeltaTime)
 {
-	// Lower the camera during slide
-	FVector CurrentLocation = FollowCamera->GetRelativeLocation();
-	FVector TargetLocation = FVector(CurrentLocation.X, CurrentLocation.Y, -SlideCameraLowerOffset);
-	FVector NewLocation = FMath::VInterpTo(CurrentLocation, TargetLocation, DeltaTime, SlideCameraSpeed);
-	
-	FollowCamera->SetRelativeLocation(NewLocation);
+	if (!FollowCamera)
+	{
+		return;
+	}
 
-	// Reset any roll from wall running
-	FRotator CurrentRotation = FollowCamera->GetRelativeRotation();
-	FRotator TargetRotation = FRotator(CurrentRotation.Pitch, CurrentRotation.Yaw, 0.0f);
-	FRotator NewRotation = FMath::RInterpTo(CurrentRotation, TargetRotation, DeltaTime, WallRunCameraTiltSpeed);
-	
-	FollowCamera->SetRelativeRotation(NewRotation);
+	// Lower the camera during slide, and reset any roll from wall running
+	const FVector CurrentLocation = FollowCamera->GetRelativeLocation();
+	const FRotator CurrentRotation = FollowCamera->GetRelativeRotation();
+	InterpCameraTo(FVector(CurrentLocation.X, CurrentLocation.Y, -SlideCameraLowerOffset),
+		FRotator(CurrentRotation.Pitch, CurrentRotation.Yaw, 0.0f), DeltaTime);
+	bCameraAtDefault = false;
 }
 
 void ARMCCharacter::ResetCameraToDefault(float DeltaTime)
 {
-	// Reset camera location
-	FVector CurrentLocation = FollowCamera->GetRelativeLocation();
-	FVector NewLocation = FMath::VInterpTo(CurrentLocation, DefaultCameraLocation, DeltaTime, SlideCameraSpeed);
-	FollowCamera->SetRelativeLocation(NewLocation);
+	if (!FollowCamera)
+	{
+		return;
+	}
+
+	bCameraAtDefault = InterpCameraTo(DefaultCameraLocation, DefaultCameraRotation, DeltaTime);
+}
+
+bool ARMCCharacter::InterpCameraTo(const FVector& TargetLocation, const FRotator& TargetRotation, float DeltaTime)
+{
+	// Closer than this, in units and degrees, counts as there
+	constexpr float CameraSettleTolerance = 0.01f;
+
+	const FVector CurrentLocation = FollowCamera->GetRelativeLocation();
+	const FRotator CurrentRotation = FollowCamera->GetRelativeRotation();
+
+	if (CurrentLocation.Equals(TargetLocation, CameraSettleTolerance) && CurrentRotation.Equals(TargetRotation, CameraSettleTolerance))
+	{
+		// Snap the last fraction once; after that there is no transform update to propagate
+		if (CurrentLocation != TargetLocation || CurrentRotation != TargetRotation)
+		{
+			FollowCamera->SetRelativeLocationAndRotation(TargetLocation, TargetRotation);
+		}
+		return true;
+	}
 
-	// Reset camera rotation
-	FRotator CurrentRotation = FollowCamera->GetRelativeRotation();
-	FRotator NewRotation = FMath::RInterpTo(CurrentRotation, DefaultCameraRotation, DeltaTime, WallRunCameraTiltSpeed);
-	FollowCamera->SetRelativeRotation(NewRotation);
+	FollowCamera->SetRelativeLocationAndRotation(
+		FMath::VInterpTo(CurrentLocation, TargetLocation, DeltaTime, SlideCameraSpeed),
+		FMath::RInterpTo(CurrentRotation, TargetRotation, DeltaTime, WallRunCameraTiltSpeed));
+	return false;
 }
\ No newline at end of file
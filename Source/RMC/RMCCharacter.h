@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "Components/Movement/RMCMovementComponent.h"
+#include "Rollback/RMCRollbackTypes.h"
 #include "RMCCharacter.generated.h"
 
 UCLASS(Blueprintable, BlueprintType, meta=(ShortTooltip="Character class with momentum-based movement system."))
@@ -25,17 +26,36 @@ public:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Track local players viewing through this character, the only ones whose camera work is seen
+	virtual void BecomeViewTarget(APlayerController* PC) override;
+	virtual void EndViewTarget(APlayerController* PC) override;
+
+	/** Whether a local player is viewing through this character */
+	bool IsLocallyViewed() const { return LocalViewerCount > 0; }
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 	// Returns the custom movement component
 	URMCMovementComponent* GetRMCMovementComponent() const;
 
-	// Returns Camera Boom
+	// Names of the optional camera components; pass to ObjectInitializer.DoNotCreateDefaultSubobject to leave them out
+	static FName CameraBoomComponentName;
+	static FName FollowCameraComponentName;
+
+	// Returns Camera Boom. Null in variants without a camera.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
 	class USpringArmComponent* CameraBoom;
 
-	// Returns Follow Camera
+	// Returns Follow Camera. Null in variants without a camera.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
 	class UCameraComponent* FollowCamera;
 
+	// Capsule history for server-side hit validation
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Network, meta = (AllowPrivateAccess = "true"))
+	class URMCLagCompensationComponent* LagCompensation;
+
 	// Camera settings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera)
 	float BaseTurnRate;
@@ -55,11 +75,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Camera)
 	float SlideCameraSpeed;
 
-	// Animation properties
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Animation)
+	// Animation properties. The wall side replicates to simulated proxies.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = Animation)
 	bool bIsWallRunningLeft;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Animation)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = Animation)
 	bool bIsWallRunningRight;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Animation)
@@ -182,27 +202,51 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Debug)
 	float WallRunSpeedMultiplier;
 
+	// Rollback
+	/** Hands movement to URMCRollbackSubsystem, which steps it at a fixed rate from recorded inputs */
+	void SetRollbackControlled(bool bEnabled);
+
+	bool IsRollbackControlled() const { return bRollbackControlled; }
+
+	/** Input gathered since the last rollback frame. Presses and releases are reported once. */
+	FRMCRollbackInput SampleRollbackInput();
+
+	/** Performs the button actions in a rollback input, as the input handlers would have */
+	void ApplyRollbackInput(const FRMCRollbackInput& Input, bool bResimulating);
+
+	// Movement LOD
+	/** Applies a tier from URMCSignificanceSubsystem to movement, wall run checks and cosmetics */
+	void SetMovementLOD(ERMCMovementLOD NewLOD);
+
+	// Pooling
+	/** Takes the character out of play for URMCCharacterPoolSubsystem: hidden, idle, uncontrolled, with movement reset and outside listeners unbound */
+	virtual void ResetForPool();
+
+	/** Puts a pooled character back into play at Transform */
+	virtual void ActivateFromPool(const FTransform& Transform);
+
+	bool IsInPool() const { return bInPool; }
+
 protected:
-	// Movement component event handlers
-	UFUNCTION()
+	/** Binds the handlers below to the movement component's native events */
+	void BindMovementEvents();
+
+	/** Sets the wall side flags, marking them dirty for push-model replication when they change */
+	void SetWallRunSide(bool bLeft, bool bRight);
+
+	// Movement component event handlers, bound to the native delegates
 	void HandleWallRunBegin(const FVector& WallNormal);
 
-	UFUNCTION()
 	void HandleWallRunEnd();
 
-	UFUNCTION()
 	void HandleSlideBegin();
 
-	UFUNCTION()
 	void HandleSlideEnd();
 
-	UFUNCTION()
 	void HandleDashBegin(const FVector& DashDirection);
 
-	UFUNCTION()
 	void HandleDashEnd();
 
-	UFUNCTION()
 	void HandleMomentumChanged(float NewMomentum);
 
 	// Getter functions for input values
@@ -227,6 +271,12 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Camera", meta = (ToolTip = "Resets camera to default position and rotation"))
 	void ResetCameraToDefault(float DeltaTime);
 
+	/**
+	 * Moves the follow camera one interpolation step toward a relative pose, in a single transform update.
+	 * Once within tolerance it snaps there and stops updating. Returns true when the camera is at the target.
+	 */
+	bool InterpCameraTo(const FVector& TargetLocation, const FRotator& TargetRotation, float DeltaTime);
+
 	// Movement input values
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Movement|Input", meta = (ToolTip = "Current forward movement input value"))
 	float ForwardInputValue;
@@ -247,4 +297,38 @@ protected:
 	// Timer handles
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Movement|Timers", meta = (ToolTip = "Timer for checking wall run conditions"))
 	FTimerHandle TimerHandle_CheckWallRun;
+
+	/** Records which movement events this class overrides in Blueprint so the rest skip ProcessEvent */
+	void CacheScriptEventImplementations();
+
+	// Movement events overridden in Blueprint, cached at BeginPlay
+	uint8 bScriptWallRunBegin : 1;
+	uint8 bScriptWallRunEnd : 1;
+	uint8 bScriptSlideBegin : 1;
+	uint8 bScriptSlideEnd : 1;
+	uint8 bScriptDashBegin : 1;
+	uint8 bScriptDashEnd : 1;
+	uint8 bScriptDoubleJump : 1;
+	uint8 bScriptMomentumChanged : 1;
+
+	// Event Tick overridden in Blueprint, which keeps the actor ticking even when its own Tick has nothing to do
+	uint8 bScriptTick : 1;
+
+	/** While rollback controlled, records a button edge for the next frame instead of acting on it. Returns true if recorded. */
+	bool RecordRollbackButton(uint8 Button);
+
+	// Rollback state
+	uint8 bRollbackControlled : 1;
+	uint8 bApplyingRollbackInput : 1;
+	uint8 bResimulatingRollback : 1;
+	uint8 PendingRollbackButtons;
+
+	// Set while waiting in a pool
+	uint8 bInPool : 1;
+
+	// Set once the camera has settled at its default pose, until a wall run or slide moves it
+	uint8 bCameraAtDefault : 1;
+
+	// Local player controllers whose view target this is
+	uint8 LocalViewerCount;
 };
\ No newline at end of file
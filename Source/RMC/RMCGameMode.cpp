@@ -4,6 +4,7 @@
 #include "RMCCharacter.h"
 #include "RMCPlayerController.h"
 #include "Components/Movement/RMCMovementComponent.h"
+#include "Mover/RMCMoverCharacter.h"
 #include "Kismet/GameplayStatics.h"
 
 ARMCGameMode::ARMCGameMode()
@@ -11,10 +12,12 @@ ARMCGameMode::ARMCGameMode()
 	// Set default classes
 	DefaultPawnClass = ARMCCharacter::StaticClass();
 	PlayerControllerClass = ARMCPlayerController::StaticClass();
+	MoverPawnClass = ARMCMoverCharacter::StaticClass();
 
 	// Set default values
 	bDebugModeEnabled = false;
 	StartingMomentum = 0.0f;
+	MovementBackend = ERMCMovementBackend::CharacterMovement;
 	bGameStarted = false;
 }
 
@@ -40,6 +43,16 @@ void ARMCGameMode::BeginPlay()
 	}
 }
 
+UClass* ARMCGameMode::GetDefaultPawnClassForController_Implementation(AController* InController)
+{
+	if (MovementBackend == ERMCMovementBackend::Mover && MoverPawnClass)
+	{
+		return MoverPawnClass;
+	}
+
+	return Super::GetDefaultPawnClassForController_Implementation(InController);
+}
+
 void ARMCGameMode::OnGameStart_Implementation()
 {
 	// Default implementation - can be overridden in Blueprints
@@ -129,7 +142,7 @@ void ARMCGameMode::ApplyStartingMomentumToCharacter(ARMCCharacter* Character)
 			MovementComponent->CurrentMomentum = StartingMomentum;
 			
 			// Trigger momentum changed event
-			MovementComponent->OnMomentumChanged.Broadcast(StartingMomentum);
+			MovementComponent->BroadcastMomentumChanged(true);
 			
 			// Check if we're starting at max momentum
 			if (StartingMomentum >= MovementComponent->MaxMomentum)
@@ -182,8 +195,8 @@ void ARMCGameMode::SetupPlayerDefaults(ARMCCharacter* Character)
 			// Store the character reference
 			MomentumCharacter = Character;
 			
-			// Create a dynamic delegate to check for max momentum when momentum changes
-			MovementComponent->OnMomentumChanged.AddDynamic(this, &ARMCGameMode::CheckForMaxMomentum);
+			// Check for max momentum when momentum changes
+			MovementComponent->OnMomentumChangedNative.AddUObject(this, &ARMCGameMode::CheckForMaxMomentum);
 		}
 	}
 }
@@ -6,6 +6,19 @@
 #include "GameFramework/GameModeBase.h"
 #include "RMCGameMode.generated.h"
 
+/**
+ * Which movement implementation player pawns use
+ */
+UENUM(BlueprintType)
+enum class ERMCMovementBackend : uint8
+{
+	/** ARMCCharacter with URMCMovementComponent */
+	CharacterMovement,
+
+	/** ARMCMoverCharacter with URMCMoverComponent */
+	Mover
+};
+
 /**
  * Game mode for the RMC game with momentum-based movement system
  */
@@ -29,6 +42,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Momentum", meta=(ToolTip="Starting momentum value for players", ClampMin="0.0"))
 	float StartingMomentum;
 
+	// Movement backend settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement", meta=(ToolTip="Movement implementation used for player pawns"))
+	ERMCMovementBackend MovementBackend;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement", meta=(ToolTip="Pawn spawned for players when the Mover backend is selected"))
+	TSubclassOf<APawn> MoverPawnClass;
+
 	// Blueprint events
 	/** Called when the game starts */
 	UFUNCTION(BlueprintNativeEvent, Category = "Game Events", meta=(ToolTip="Called when the game starts"))
@@ -60,12 +80,14 @@ public:
 	/** Called when a new player joins the game */
 	virtual void HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer) override;
 
+	/** Picks the pawn class for the selected movement backend */
+	virtual UClass* GetDefaultPawnClassForController_Implementation(AController* InController) override;
+
 protected:
 	// Helper functions
 	void SetupPlayerDefaults(class ARMCCharacter* Character);
 	
 	/** Checks if a character has reached max momentum */
-	UFUNCTION()
 	void CheckForMaxMomentum(float NewMomentum);
 	
 	// Flag to track if game has started
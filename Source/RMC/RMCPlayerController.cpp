@@ -3,6 +3,9 @@
 #include "RMCPlayerController.h"
 #include "RMCCharacter.h"
 #include "Components/Movement/RMCMovementComponent.h"
+#include "Rollback/RMCRollbackSubsystem.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerState.h"
 #include "GameFramework/Character.h"
 #include "Engine/World.h"
 #include "Engine/Canvas.h"
@@ -48,6 +51,12 @@ void ARMCPlayerController::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	// The server's copies of remote players' controllers have no view to update
+	if (!IsLocalController())
+	{
+		return;
+	}
+
 	// Update camera FOV based on speed
 	UpdateCameraFOV(DeltaTime);
 
@@ -236,4 +245,52 @@ void ARMCPlayerController::DisplayDebugInfo()
 		// Display debug info on screen
 		GEngine->AddOnScreenDebugMessage(0, 0.0f, FColor::Yellow, DebugInfo);
 	}
-}
\ No newline at end of file
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Rollback input relay
+
+void ARMCPlayerController::ServerSendRollbackInputs_Implementation(const FRMCRollbackInputPacket& Packet)
+{
+	// The sender's id comes from its connection, not from the packet
+	FRMCRollbackInputPacket Relayed = Packet;
+	Relayed.PlayerId = PlayerState ? PlayerState->GetPlayerId() : INDEX_NONE;
+	if (Relayed.PlayerId == INDEX_NONE || Relayed.FirstFrame < 0)
+	{
+		return;
+	}
+
+	if (Relayed.Inputs.Num() > FRMCRollbackHistory::Capacity)
+	{
+		Relayed.Inputs.SetNum(FRMCRollbackHistory::Capacity);
+	}
+
+	if (URMCRollbackSubsystem* Subsystem = GetWorld()->GetSubsystem<URMCRollbackSubsystem>())
+	{
+		Subsystem->ReceiveInputPacket(Relayed);
+	}
+
+	for (TActorIterator<ARMCPlayerController> It(GetWorld()); It; ++It)
+	{
+		if (*It != this && !It->IsLocalController())
+		{
+			It->ClientReceiveRollbackInputs(Relayed);
+		}
+	}
+}
+
+void ARMCPlayerController::ClientReceiveRollbackInputs_Implementation(const FRMCRollbackInputPacket& Packet)
+{
+	if (URMCRollbackSubsystem* Subsystem = GetWorld()->GetSubsystem<URMCRollbackSubsystem>())
+	{
+		Subsystem->ReceiveInputPacket(Packet);
+	}
+}
+
+void ARMCPlayerController::ClientStartRollbackSession_Implementation(double StartServerTime)
+{
+	if (URMCRollbackSubsystem* Subsystem = GetWorld()->GetSubsystem<URMCRollbackSubsystem>())
+	{
+		Subsystem->StartSessionAt(StartServerTime);
+	}
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "Rollback/RMCRollbackTypes.h"
 #include "RMCPlayerController.generated.h"
 
 /**
@@ -92,6 +93,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Movement")
 	float GetSpeedPercent() const;
 
+	// Rollback input relay
+	/** Sends this player's recent rollback inputs to the server, which applies them and passes them on */
+	UFUNCTION(Server, Unreliable)
+	void ServerSendRollbackInputs(const FRMCRollbackInputPacket& Packet);
+
+	/** Delivers another player's rollback inputs */
+	UFUNCTION(Client, Unreliable)
+	void ClientReceiveRollbackInputs(const FRMCRollbackInputPacket& Packet);
+
+	/** Starts the rollback session on this client, with frame 0 at StartServerTime in server world time */
+	UFUNCTION(Client, Reliable)
+	void ClientStartRollbackSession(double StartServerTime);
+
 protected:
 	// Input handlers
 	void OnToggleDebugInfo();
@@ -0,0 +1,287 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "TimerManager.h"
+#include "../RMCCharacter.h"
+#include "../Components/Movement/RMCMoveBandwidthStats.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Bandwidth report
+
+namespace RMCNetCommands
+{
+    struct FConnectionBandwidth
+    {
+        int64 TotalOutBytes = 0;
+        int64 TotalInBytes = 0;
+        int32 PeakOutBytesPerSecond = 0;
+        int32 Samples = 0;
+    };
+
+    struct FBandwidthRecording
+    {
+        TWeakObjectPtr<UWorld> World;
+        FTimerHandle Timer;
+        int32 SecondsRemaining = 0;
+        TMap<FString, FConnectionBandwidth> Connections;
+    };
+
+    static FBandwidthRecording Recording;
+
+    static FString DescribeConnection(const UNetConnection* Connection)
+    {
+        const APlayerController* Controller = Connection->PlayerController;
+        if (Controller && Controller->PlayerState)
+        {
+            return Controller->PlayerState->GetPlayerName();
+        }
+        return Connection->LowLevelGetRemoteAddress(true);
+    }
+
+    static TArray<UNetConnection*> GetConnections(UWorld* World)
+    {
+        TArray<UNetConnection*> Connections;
+        if (UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr)
+        {
+            if (NetDriver->ServerConnection)
+            {
+                Connections.Add(NetDriver->ServerConnection);
+            }
+            Connections.Append(NetDriver->ClientConnections);
+        }
+        return Connections;
+    }
+
+    /** How many RMC characters are idle and their average update rate right now */
+    static void LogCharacterRates(UWorld* World)
+    {
+        int32 NumCharacters = 0;
+        int32 NumIdle = 0;
+        float TotalFrequency = 0.0f;
+        for (TActorIterator<ARMCCharacter> It(World); It; ++It)
+        {
+            const URMCMovementComponent* MovementComponent = It->GetRMCMovementComponent();
+            ++NumCharacters;
+            TotalFrequency += It->NetUpdateFrequency;
+            if (MovementComponent && It->NetUpdateFrequency <= MovementComponent->IdleNetUpdateFrequency)
+            {
+                ++NumIdle;
+            }
+        }
+
+        if (NumCharacters > 0)
+        {
+            UE_LOG(LogTemp, Display, TEXT("  %d RMC characters, %d idle, average NetUpdateFrequency %.1f"),
+                NumCharacters, NumIdle, TotalFrequency / NumCharacters);
+        }
+    }
+
+    static void LogCurrent(UWorld* World)
+    {
+        const TArray<UNetConnection*> Connections = GetConnections(World);
+        UE_LOG(LogTemp, Display, TEXT("Bandwidth: %d connections"), Connections.Num());
+        for (const UNetConnection* Connection : Connections)
+        {
+            UE_LOG(LogTemp, Display, TEXT("  %s: out %d B/s, in %d B/s"),
+                *DescribeConnection(Connection), Connection->OutBytesPerSecond, Connection->InBytesPerSecond);
+        }
+        LogCharacterRates(World);
+    }
+
+    static void FinishRecording()
+    {
+        UE_LOG(LogTemp, Display, TEXT("Recorded bandwidth: %d connections"), Recording.Connections.Num());
+
+        int64 TotalOutBytes = 0;
+        int32 TotalSamples = 0;
+        for (const TPair<FString, FConnectionBandwidth>& Pair : Recording.Connections)
+        {
+            const FConnectionBandwidth& Bandwidth = Pair.Value;
+            const int32 Samples = FMath::Max(Bandwidth.Samples, 1);
+            UE_LOG(LogTemp, Display, TEXT("  %s: out %lld B/s average, %d B/s peak, in %lld B/s average over %d s"),
+                *Pair.Key, Bandwidth.TotalOutBytes / Samples, Bandwidth.PeakOutBytesPerSecond, Bandwidth.TotalInBytes / Samples, Bandwidth.Samples);
+
+            TotalOutBytes += Bandwidth.TotalOutBytes;
+            TotalSamples += Bandwidth.Samples;
+        }
+
+        if (TotalSamples > 0)
+        {
+            UE_LOG(LogTemp, Display, TEXT("  Average per connection: out %lld B/s"), TotalOutBytes / TotalSamples);
+        }
+
+        if (UWorld* World = Recording.World.Get())
+        {
+            LogCharacterRates(World);
+            World->GetTimerManager().ClearTimer(Recording.Timer);
+        }
+        Recording = FBandwidthRecording();
+    }
+
+    static void SampleRecording()
+    {
+        UWorld* World = Recording.World.Get();
+        if (!World)
+        {
+            Recording = FBandwidthRecording();
+            return;
+        }
+
+        for (const UNetConnection* Connection : GetConnections(World))
+        {
+            FConnectionBandwidth& Bandwidth = Recording.Connections.FindOrAdd(DescribeConnection(Connection));
+            Bandwidth.TotalOutBytes += Connection->OutBytesPerSecond;
+            Bandwidth.TotalInBytes += Connection->InBytesPerSecond;
+            Bandwidth.PeakOutBytesPerSecond = FMath::Max(Bandwidth.PeakOutBytesPerSecond, Connection->OutBytesPerSecond);
+            ++Bandwidth.Samples;
+        }
+
+        if (--Recording.SecondsRemaining <= 0)
+        {
+            FinishRecording();
+        }
+    }
+
+    static FAutoConsoleCommandWithWorldAndArgs BandwidthCommand(
+        TEXT("rmc.Net.Bandwidth"),
+        TEXT("Logs bytes/sec for each connection and the RMC character update rates. Usage: rmc.Net.Bandwidth [Seconds] to record and report averages."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            if (!World)
+            {
+                return;
+            }
+
+            const int32 Seconds = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 0;
+            if (Seconds <= 0)
+            {
+                LogCurrent(World);
+                return;
+            }
+
+            if (UWorld* PreviousWorld = Recording.World.Get())
+            {
+                PreviousWorld->GetTimerManager().ClearTimer(Recording.Timer);
+            }
+
+            Recording = FBandwidthRecording();
+            Recording.World = World;
+            Recording.SecondsRemaining = Seconds;
+            World->GetTimerManager().SetTimer(Recording.Timer, FTimerDelegate::CreateStatic(&SampleRecording), 1.0f, true);
+            UE_LOG(LogTemp, Display, TEXT("Recording bandwidth for %d s"), Seconds);
+        }));
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Client-authoritative movement
+
+namespace RMCNetCommands
+{
+    static FAutoConsoleCommandWithWorldAndArgs ClientAuthCommand(
+        TEXT("rmc.Net.ClientAuth"),
+        TEXT("Logs how many client moves each RMC character took without simulating and how many fell outside the envelope. Usage: rmc.Net.ClientAuth [0|1] to switch client-authoritative movement off or on first."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            if (!World)
+            {
+                return;
+            }
+
+            const bool bSet = Args.Num() > 0;
+            const bool bEnable = bSet && FCString::Atoi(*Args[0]) != 0;
+
+            int64 TotalAccepted = 0;
+            int64 TotalRejected = 0;
+            for (TActorIterator<ARMCCharacter> It(World); It; ++It)
+            {
+                URMCMovementComponent* MovementComponent = It->GetRMCMovementComponent();
+                if (!MovementComponent)
+                {
+                    continue;
+                }
+
+                if (bSet)
+                {
+                    MovementComponent->bClientAuthoritativeMovement = bEnable;
+                }
+
+                const int32 Accepted = MovementComponent->GetClientAuthMovesAccepted();
+                const int32 Rejected = MovementComponent->GetClientAuthMovesRejected();
+                UE_LOG(LogTemp, Display, TEXT("  %s: %s, %d moves accepted, %d simulated"), *It->GetName(),
+                    MovementComponent->bClientAuthoritativeMovement ? TEXT("client authoritative") : TEXT("server authoritative"), Accepted, Rejected);
+
+                TotalAccepted += Accepted;
+                TotalRejected += Rejected;
+            }
+
+            const int64 TotalMoves = TotalAccepted + TotalRejected;
+            UE_LOG(LogTemp, Display, TEXT("Client-authoritative moves: %lld accepted, %lld simulated (%.1f%% outside the envelope)"),
+                TotalAccepted, TotalRejected, TotalMoves > 0 ? 100.0 * TotalRejected / TotalMoves : 0.0);
+        }));
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Movement bandwidth
+
+namespace RMCNetCommands
+{
+    static FAutoConsoleCommandWithWorldAndArgs DumpMoveBandwidthCommand(
+        TEXT("rmc.Net.DumpMoveBandwidth"),
+        TEXT("Logs the bits ServerMove and move response messages took per movement mode and writes them with size histograms to Saved/Profiling. ")
+        TEXT("Usage: rmc.Net.DumpMoveBandwidth [reset] to clear the counts afterwards."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            if (!World)
+            {
+                return;
+            }
+
+            FRMCMoveBandwidthStats& Stats = FRMCMoveBandwidthStats::Get();
+            const double Now = World->GetTimeSeconds();
+            const double Seconds = Stats.StartTime >= 0.0 ? FMath::Max(Now - Stats.StartTime, 1.0) : 1.0;
+
+            int32 NumCharacters = 0;
+            for (TActorIterator<ARMCCharacter> It(World); It; ++It)
+            {
+                ++NumCharacters;
+            }
+
+            UE_LOG(LogTemp, Display, TEXT("Movement bandwidth over %.0f s, %d RMC characters in this world"), Seconds, NumCharacters);
+            const UEnum* ModeEnum = StaticEnum<ERMCPredictedMovementMode>();
+            for (int32 TrafficIndex = 0; TrafficIndex < FRMCMoveBandwidthStats::NumTraffic; ++TrafficIndex)
+            {
+                for (int32 ModeIndex = 0; ModeIndex < FRMCMoveBandwidthStats::NumModes; ++ModeIndex)
+                {
+                    const int32 Messages = Stats.Messages[TrafficIndex][ModeIndex];
+                    if (Messages == 0)
+                    {
+                        continue;
+                    }
+
+                    const int64 Bits = Stats.Bits[TrafficIndex][ModeIndex];
+                    UE_LOG(LogTemp, Display, TEXT("  %s %s: %d messages, %.1f bits each, %.0f bits/s"),
+                        FRMCMoveBandwidthStats::GetTrafficName(static_cast<ERMCMoveTraffic>(TrafficIndex)), *ModeEnum->GetNameStringByIndex(ModeIndex),
+                        Messages, static_cast<double>(Bits) / Messages, Bits / Seconds);
+                }
+            }
+
+            const FString Path = FPaths::ProfilingDir() / FString::Printf(TEXT("RMCMoveBandwidth-%s.csv"), *FDateTime::Now().ToString());
+            if (Stats.WriteCsv(Path, Now))
+            {
+                UE_LOG(LogTemp, Display, TEXT("  Written to %s"), *Path);
+            }
+
+            if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+            {
+                Stats.Reset();
+            }
+        }));
+}
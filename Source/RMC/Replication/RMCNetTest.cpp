@@ -0,0 +1,587 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "GameMapsSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "../RMCCharacter.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationEditorCommon.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Network emulation correction test
+
+namespace RMCNetTest
+{
+    /** Packet conditions, and the limits a run under them must stay within */
+    struct FProfile
+    {
+        const TCHAR* Name;
+        int32 PktLag;
+        int32 PktLagVariance;
+        int32 PktLoss;
+
+        // Fraction of checked moves the server may correct
+        float MaxCorrectionRate;
+
+        // Mean distance between client and server positions allowed in any one mode
+        float MaxMeanError;
+    };
+
+    static const FProfile Profiles[] =
+    {
+        { TEXT("Off"), 0, 0, 0, 0.01f, 5.0f },
+        { TEXT("Average"), 60, 10, 1, 0.03f, 10.0f },
+        { TEXT("Bad"), 150, 40, 5, 0.08f, 25.0f },
+    };
+
+    enum class EAction : uint8
+    {
+        None,
+        Jump,
+        Dash,
+        Slide
+    };
+
+    /** One scripted stretch of input */
+    struct FStep
+    {
+        const TCHAR* Name;
+        float Duration;
+        float Forward;
+        float Right;
+
+        // Pressed when the step starts
+        EAction Action;
+
+        // Seconds into the step to press the action again, or negative for never
+        float RepeatAt;
+    };
+
+    // The wall run step strafes while airborne; ARMCCharacter::TryWallRun starts a run if the map has a wall there
+    static const FStep Script[] =
+    {
+        { TEXT("Run"), 1.5f, 1.0f, 0.0f, EAction::None, -1.0f },
+        { TEXT("Jump"), 1.0f, 1.0f, 0.0f, EAction::Jump, -1.0f },
+        { TEXT("Double jump"), 1.2f, 1.0f, 0.0f, EAction::Jump, 0.3f },
+        { TEXT("Dash"), 1.0f, 1.0f, 0.0f, EAction::Dash, -1.0f },
+        { TEXT("Slide"), 1.2f, 1.0f, 0.0f, EAction::Slide, -1.0f },
+        { TEXT("Wall run"), 2.0f, 1.0f, 1.0f, EAction::Jump, -1.0f },
+        { TEXT("Settle"), 1.0f, 0.0f, 0.0f, EAction::None, -1.0f },
+    };
+
+    struct FRun
+    {
+        TWeakObjectPtr<UWorld> World;
+        TWeakObjectPtr<ARMCCharacter> Character;
+        const FProfile* Profile = nullptr;
+        int32 PassesRemaining = 0;
+        int32 StepIndex = 0;
+        float StepTime = 0.0f;
+        bool bStepStarted = false;
+        bool bRepeated = false;
+        bool bReleaseJump = false;
+        FTSTicker::FDelegateHandle Ticker;
+    };
+
+    static FRun Run;
+
+    /** Outcome of the last run, kept after it finishes for whoever started it */
+    struct FResult
+    {
+        bool bFinished = false;
+
+        // One line per limit the run went over, or why it could not be judged
+        TArray<FString> Failures;
+    };
+
+    static FResult LastResult;
+
+    static const FProfile* FindProfile(const FString& Name)
+    {
+        for (const FProfile& Profile : Profiles)
+        {
+            if (Name.Equals(Profile.Name, ESearchCase::IgnoreCase))
+            {
+                return &Profile;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Network emulation settings are process wide, so in a single-process session they apply to the server too */
+    static void ApplyEmulation(UWorld* World, const FProfile& Profile)
+    {
+        GEngine->Exec(World, *FString::Printf(TEXT("NetEmulation.PktLag %d"), Profile.PktLag));
+        GEngine->Exec(World, *FString::Printf(TEXT("NetEmulation.PktLagVariance %d"), Profile.PktLagVariance));
+        GEngine->Exec(World, *FString::Printf(TEXT("NetEmulation.PktLoss %d"), Profile.PktLoss));
+    }
+
+    /** The server world in this process that the client world is connected to, for PIE sessions */
+    static UWorld* FindServerWorld(const UWorld* ClientWorld)
+    {
+        for (const FWorldContext& Context : GEngine->GetWorldContexts())
+        {
+            UWorld* World = Context.World();
+            if (World && World != ClientWorld && (World->GetNetMode() == NM_DedicatedServer || World->GetNetMode() == NM_ListenServer))
+            {
+                return World;
+            }
+        }
+        return nullptr;
+    }
+
+    static void ResetServerStats(UWorld* ServerWorld)
+    {
+        for (TActorIterator<ARMCCharacter> It(ServerWorld); It; ++It)
+        {
+            if (URMCMovementComponent* MovementComponent = It->GetRMCMovementComponent())
+            {
+                MovementComponent->ResetCorrectionStats();
+            }
+        }
+    }
+
+    /** Logs the server's correction stats against the profile's limits and resets them. Adds a line to OutFailures for each limit exceeded. */
+    static void Evaluate(UWorld* ServerWorld, const FProfile& Profile, TArray<FString>& OutFailures)
+    {
+        FRMCCorrectionStats Stats;
+        for (TActorIterator<ARMCCharacter> It(ServerWorld); It; ++It)
+        {
+            if (URMCMovementComponent* MovementComponent = It->GetRMCMovementComponent())
+            {
+                Stats.Append(MovementComponent->GetCorrectionStats());
+                MovementComponent->ResetCorrectionStats();
+            }
+        }
+
+        const float CorrectionRate = Stats.GetCorrectionRate();
+        if (Stats.GetTotalMovesChecked() == 0)
+        {
+            OutFailures.Add(TEXT("The server checked no moves"));
+        }
+        else if (CorrectionRate > Profile.MaxCorrectionRate)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%.2f%% of moves corrected, limit %.2f%%"), CorrectionRate * 100.0f, Profile.MaxCorrectionRate * 100.0f));
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("RMC net test, profile %s (lag %d ms +/- %d, loss %d%%): %d moves checked, %d corrected (%.2f%%, limit %.2f%%)"),
+            Profile.Name, Profile.PktLag, Profile.PktLagVariance, Profile.PktLoss, Stats.GetTotalMovesChecked(), Stats.GetTotalCorrections(),
+            CorrectionRate * 100.0f, Profile.MaxCorrectionRate * 100.0f);
+
+        const UEnum* ModeEnum = StaticEnum<ERMCPredictedMovementMode>();
+        for (int32 Index = 0; Index < FRMCCorrectionStats::NumModes; ++Index)
+        {
+            if (Stats.MovesChecked[Index] == 0)
+            {
+                continue;
+            }
+
+            const float MeanError = Stats.GetMeanError(static_cast<ERMCPredictedMovementMode>(Index));
+            const bool bModePassed = MeanError <= Profile.MaxMeanError;
+            if (!bModePassed)
+            {
+                OutFailures.Add(FString::Printf(TEXT("%s mean error %.1f, limit %.1f"), *ModeEnum->GetNameStringByIndex(Index), MeanError, Profile.MaxMeanError));
+            }
+
+            UE_LOG(LogTemp, Display, TEXT("  %s: %d moves, %d corrected, error mean %.1f max %.1f%s"),
+                *ModeEnum->GetNameStringByIndex(Index), Stats.MovesChecked[Index], Stats.Corrections[Index], MeanError, Stats.MaxError[Index],
+                bModePassed ? TEXT("") : TEXT(" (over the limit)"));
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("RMC net test %s"), OutFailures.Num() == 0 ? TEXT("PASSED") : TEXT("FAILED"));
+    }
+
+    static void Finish(TArray<FString>&& Failures)
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(Run.Ticker);
+        if (UWorld* World = Run.World.Get())
+        {
+            ApplyEmulation(World, Profiles[0]);
+        }
+        Run = FRun();
+
+        LastResult.bFinished = true;
+        LastResult.Failures = MoveTemp(Failures);
+    }
+
+    static void PressAction(ARMCCharacter* Character, EAction Action)
+    {
+        switch (Action)
+        {
+        case EAction::Jump:
+            Character->OnJumpActionPressed();
+            Run.bReleaseJump = true;
+            break;
+        case EAction::Dash:
+            Character->OnDashActionPressed();
+            break;
+        case EAction::Slide:
+            Character->OnSlideActionPressed();
+            break;
+        default:
+            break;
+        }
+    }
+
+    static bool Tick(float DeltaTime)
+    {
+        ARMCCharacter* Character = Run.Character.Get();
+        UWorld* World = Run.World.Get();
+        if (!Character || !World)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("RMC net test stopped: the test character is gone"));
+            Finish({ TEXT("The test character is gone") });
+            return false;
+        }
+
+        const FStep& Step = Script[Run.StepIndex];
+
+        // Jumps are held for one frame
+        if (Run.bReleaseJump)
+        {
+            Character->OnJumpActionReleased();
+            Run.bReleaseJump = false;
+        }
+
+        if (!Run.bStepStarted)
+        {
+            Run.bStepStarted = true;
+            PressAction(Character, Step.Action);
+        }
+        else if (Step.RepeatAt >= 0.0f && !Run.bRepeated && Run.StepTime >= Step.RepeatAt)
+        {
+            Run.bRepeated = true;
+            PressAction(Character, Step.Action);
+        }
+
+        Character->MoveForward(Step.Forward);
+        Character->MoveRight(Step.Right);
+
+        Run.StepTime += DeltaTime;
+        if (Run.StepTime < Step.Duration)
+        {
+            return true;
+        }
+
+        if (Step.Action == EAction::Slide)
+        {
+            Character->OnSlideActionReleased();
+        }
+
+        Run.StepTime = 0.0f;
+        Run.bStepStarted = false;
+        Run.bRepeated = false;
+        if (++Run.StepIndex < UE_ARRAY_COUNT(Script))
+        {
+            return true;
+        }
+
+        Run.StepIndex = 0;
+        if (--Run.PassesRemaining > 0)
+        {
+            return true;
+        }
+
+        UWorld* ServerWorld = FindServerWorld(World);
+        if (!ServerWorld)
+        {
+            UE_LOG(LogTemp, Display, TEXT("RMC net test script done. The server is in another process: run rmc.NetTest.Report %s there for the result."),
+                Run.Profile->Name);
+            Finish({ TEXT("The server is in another process, so its correction stats can't be read") });
+            return false;
+        }
+
+        TArray<FString> Failures;
+        Evaluate(ServerWorld, *Run.Profile, Failures);
+        Finish(MoveTemp(Failures));
+        return false;
+    }
+
+    /** Starts the script on World's local character. Returns false, with the reason in OutError, if it can't. */
+    static bool Start(UWorld* World, const FProfile& Profile, int32 Passes, FString& OutError)
+    {
+        if (!World || World->GetNetMode() != NM_Client)
+        {
+            OutError = TEXT("The net test needs a client world: only client moves are checked by the server");
+            return false;
+        }
+
+        const APlayerController* Controller = World->GetFirstPlayerController();
+        ARMCCharacter* Character = Controller ? Cast<ARMCCharacter>(Controller->GetPawn()) : nullptr;
+        if (!Character)
+        {
+            OutError = TEXT("The net test needs a locally controlled RMC character");
+            return false;
+        }
+
+        if (Run.Ticker.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(Run.Ticker);
+        }
+
+        Run = FRun();
+        Run.World = World;
+        Run.Character = Character;
+        Run.Profile = &Profile;
+        Run.PassesRemaining = FMath::Max(Passes, 1);
+        LastResult = FResult();
+
+        if (UWorld* ServerWorld = FindServerWorld(World))
+        {
+            ResetServerStats(ServerWorld);
+        }
+
+        ApplyEmulation(World, Profile);
+        Run.Ticker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&Tick));
+
+        UE_LOG(LogTemp, Display, TEXT("RMC net test: %d passes of the movement script under profile %s"), Run.PassesRemaining, Profile.Name);
+        return true;
+    }
+
+    /** A PIE client world in this process, for the automation test */
+    static UWorld* FindClientWorld()
+    {
+        for (const FWorldContext& Context : GEngine->GetWorldContexts())
+        {
+            UWorld* World = Context.World();
+            if (World && Context.WorldType == EWorldType::PIE && World->GetNetMode() == NM_Client)
+            {
+                return World;
+            }
+        }
+        return nullptr;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Automation test
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RMCNetTest
+{
+    // Longer than the slowest script at the default pass count, allowing for lag
+    constexpr double RunTimeoutSeconds = 120.0;
+    constexpr int32 AutomationPasses = 3;
+
+    // Time for PIE to start its server, connect the client and spawn its character
+    constexpr double SessionTimeoutSeconds = 60.0;
+
+#if WITH_EDITOR
+    /** Plays the open map as one client, with its dedicated server in this process so the server's stats can be read */
+    class FStartNetPIECommand : public IAutomationLatentCommand
+    {
+    public:
+        virtual bool Update() override
+        {
+            ULevelEditorPlaySettings* PlaySettings = NewObject<ULevelEditorPlaySettings>();
+            PlaySettings->SetPlayNetMode(EPlayNetMode::PIE_Client);
+            PlaySettings->SetPlayNumberOfClients(1);
+            PlaySettings->SetRunUnderOneProcess(true);
+
+            FRequestPlaySessionParams Params;
+            Params.EditorPlaySettings = PlaySettings;
+            GEditor->RequestPlaySession(Params);
+            return true;
+        }
+    };
+#endif
+
+    /** Waits until a PIE client in this process is connected to its server and controls an RMC character */
+    class FWaitForSessionCommand : public IAutomationLatentCommand
+    {
+    public:
+        explicit FWaitForSessionCommand(FAutomationTestBase* InTest) : Test(InTest), StartSeconds(FPlatformTime::Seconds()) {}
+
+        virtual bool Update() override
+        {
+            UWorld* ClientWorld = FindClientWorld();
+            const APlayerController* Controller = ClientWorld ? ClientWorld->GetFirstPlayerController() : nullptr;
+            if (Controller && Cast<ARMCCharacter>(Controller->GetPawn()) && FindServerWorld(ClientWorld))
+            {
+                return true;
+            }
+
+            if (FPlatformTime::Seconds() - StartSeconds < SessionTimeoutSeconds)
+            {
+                return false;
+            }
+
+            Test->AddError(FString::Printf(TEXT("No PIE client controlling an RMC character within %.0f seconds"), SessionTimeoutSeconds));
+            return true;
+        }
+
+    private:
+        FAutomationTestBase* Test;
+        double StartSeconds;
+    };
+
+    /** Starts the script on the PIE client, or records why it could not for FWaitForRunCommand to report */
+    class FStartRunCommand : public IAutomationLatentCommand
+    {
+    public:
+        explicit FStartRunCommand(const FProfile& InProfile) : Profile(InProfile) {}
+
+        virtual bool Update() override
+        {
+            FString Error;
+            if (!Start(FindClientWorld(), Profile, AutomationPasses, Error))
+            {
+                LastResult = FResult();
+                LastResult.bFinished = true;
+                LastResult.Failures.Add(Error);
+            }
+            return true;
+        }
+
+    private:
+        const FProfile& Profile;
+    };
+
+    /** Waits for the script to finish, then fails the test with every limit the run went over */
+    class FWaitForRunCommand : public IAutomationLatentCommand
+    {
+    public:
+        explicit FWaitForRunCommand(FAutomationTestBase* InTest) : Test(InTest), StartSeconds(FPlatformTime::Seconds()) {}
+
+        virtual bool Update() override
+        {
+            if (!LastResult.bFinished)
+            {
+                if (FPlatformTime::Seconds() - StartSeconds < RunTimeoutSeconds)
+                {
+                    return false;
+                }
+
+                Finish({ FString::Printf(TEXT("The script did not finish within %.0f seconds"), RunTimeoutSeconds) });
+            }
+
+            for (const FString& Failure : LastResult.Failures)
+            {
+                Test->AddError(Failure);
+            }
+            return true;
+        }
+
+    private:
+        FAutomationTestBase* Test;
+        double StartSeconds;
+    };
+}
+
+/**
+ * Runs the movement script under each network profile and fails on any correction rate or per-mode error
+ * over the profile's limits. Uses a running PIE session with a client and its server in one process, or
+ * in the editor opens the game's default map and plays it as one client, stopping PIE afterwards.
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FRMCNetCorrectionTest, "RMC.Net.Corrections",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+void FRMCNetCorrectionTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    for (const RMCNetTest::FProfile& Profile : RMCNetTest::Profiles)
+    {
+        OutBeautifiedNames.Add(Profile.Name);
+        OutTestCommands.Add(Profile.Name);
+    }
+}
+
+bool FRMCNetCorrectionTest::RunTest(const FString& Parameters)
+{
+    const RMCNetTest::FProfile* Profile = RMCNetTest::FindProfile(Parameters);
+    if (!Profile)
+    {
+        AddError(FString::Printf(TEXT("Unknown network profile %s"), *Parameters));
+        return false;
+    }
+
+    const UWorld* ClientWorld = RMCNetTest::FindClientWorld();
+    const bool bSessionRunning = ClientWorld && RMCNetTest::FindServerWorld(ClientWorld);
+
+    if (!bSessionRunning)
+    {
+#if WITH_EDITOR
+        if (!GEditor || GEditor->IsPlaySessionInProgress())
+        {
+            AddError(TEXT("Needs the editor with no PIE session running, or a PIE session with a client and its server in this process"));
+            return false;
+        }
+
+        const FString MapName = FSoftObjectPath(UGameMapsSettings::GetGameDefaultMap()).GetLongPackageName();
+        ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(MapName));
+        ADD_LATENT_AUTOMATION_COMMAND(RMCNetTest::FStartNetPIECommand());
+#else
+        AddError(TEXT("Needs a PIE session with a client and its server in this process (Run Under One Process)"));
+        return false;
+#endif
+    }
+
+    ADD_LATENT_AUTOMATION_COMMAND(RMCNetTest::FWaitForSessionCommand(this));
+    ADD_LATENT_AUTOMATION_COMMAND(RMCNetTest::FStartRunCommand(*Profile));
+    ADD_LATENT_AUTOMATION_COMMAND(RMCNetTest::FWaitForRunCommand(this));
+
+    // Leave a session the tester started running for the next profile
+    if (!bSessionRunning)
+    {
+        ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand());
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+
+//////////////////////////////////////////////////////////////////////////
+// Console commands
+
+namespace RMCNetTest
+{
+    static FAutoConsoleCommandWithWorldAndArgs RunCommand(
+        TEXT("rmc.NetTest.Run"),
+        TEXT("Drives the local RMC character through runs, jumps, double jumps, dashes, slides and wall runs under emulated lag, jitter and loss, ")
+        TEXT("then checks the server's corrections against the profile's limits. Usage: rmc.NetTest.Run [Off|Average|Bad] [Passes=3]. ")
+        TEXT("The RMC.Net.Corrections automation test runs the same check and fails on it."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            const FProfile* Profile = FindProfile(Args.Num() > 0 ? Args[0] : TEXT("Average"));
+            if (!Profile)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Unknown network profile. Profiles: Off, Average, Bad"));
+                return;
+            }
+
+            FString Error;
+            if (!Start(World, *Profile, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 3, Error))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("rmc.NetTest.Run: %s"), *Error);
+            }
+        }));
+
+    static FAutoConsoleCommandWithWorldAndArgs ReportCommand(
+        TEXT("rmc.NetTest.Report"),
+        TEXT("On a server, checks the correction stats gathered since the last report against a profile's limits and resets them. ")
+        TEXT("Usage: rmc.NetTest.Report [Off|Average|Bad]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            const FProfile* Profile = FindProfile(Args.Num() > 0 ? Args[0] : TEXT("Average"));
+            if (!World || !Profile)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Unknown network profile. Profiles: Off, Average, Bad"));
+                return;
+            }
+
+            TArray<FString> Failures;
+            Evaluate(World, *Profile, Failures);
+        }));
+}
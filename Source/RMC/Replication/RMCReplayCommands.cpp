@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "Engine/DemoNetDriver.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/Paths.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Replay size and scrub latency
+//
+// Record a session with demorec <Name> on the server and demostop at the end, then play it back with
+// demoplay <Name>. RMC state reaches the replay through the same push-model properties proxies use, so
+// checkpoints hold a few bytes per character and the stream only carries changes.
+
+namespace RMCReplayCommands
+{
+    /** File the local replay streamer writes for the replay being recorded or played */
+    static FString GetReplayPath(const UDemoNetDriver* DemoDriver)
+    {
+        return FPaths::ProjectSavedDir() / TEXT("Demos") / DemoDriver->GetActiveReplayName() + TEXT(".replay");
+    }
+
+    struct FScrubTest
+    {
+        TWeakObjectPtr<UDemoNetDriver> DemoDriver;
+        FRandomStream Random;
+        int32 JumpsRemaining = 0;
+        int32 Jumps = 0;
+        int32 Failures = 0;
+        double JumpStartSeconds = 0.0;
+        double TotalSeconds = 0.0;
+        double MaxSeconds = 0.0;
+    };
+
+    static FScrubTest ScrubTest;
+
+    static void NextScrubJump();
+
+    static void OnScrubJumpFinished(const bool bWasSuccessful)
+    {
+        const double Seconds = FPlatformTime::Seconds() - ScrubTest.JumpStartSeconds;
+        if (bWasSuccessful)
+        {
+            ++ScrubTest.Jumps;
+            ScrubTest.TotalSeconds += Seconds;
+            ScrubTest.MaxSeconds = FMath::Max(ScrubTest.MaxSeconds, Seconds);
+        }
+        else
+        {
+            ++ScrubTest.Failures;
+        }
+
+        NextScrubJump();
+    }
+
+    static void NextScrubJump()
+    {
+        UDemoNetDriver* DemoDriver = ScrubTest.DemoDriver.Get();
+        if (!DemoDriver || ScrubTest.JumpsRemaining <= 0)
+        {
+            UE_LOG(LogTemp, Display, TEXT("RMC replay scrub: %d jumps, %.1f ms mean, %.1f ms max, %d failed"), ScrubTest.Jumps,
+                ScrubTest.Jumps > 0 ? ScrubTest.TotalSeconds * 1000.0 / ScrubTest.Jumps : 0.0, ScrubTest.MaxSeconds * 1000.0, ScrubTest.Failures);
+            ScrubTest.DemoDriver.Reset();
+            return;
+        }
+
+        --ScrubTest.JumpsRemaining;
+        ScrubTest.JumpStartSeconds = FPlatformTime::Seconds();
+        DemoDriver->GotoTimeInSeconds(ScrubTest.Random.FRandRange(0.0f, DemoDriver->GetDemoTotalTime()),
+            FOnGotoTimeDelegate::CreateStatic(&OnScrubJumpFinished));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Console commands
+
+    static FAutoConsoleCommandWithWorldAndArgs StatsCommand(
+        TEXT("rmc.Replay.Stats"),
+        TEXT("Logs the length and file size of the replay being recorded or played, and its size per minute"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            const UDemoNetDriver* DemoDriver = World ? World->GetDemoNetDriver() : nullptr;
+            if (!DemoDriver)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("rmc.Replay.Stats: no replay is recording or playing"));
+                return;
+            }
+
+            const FString Path = GetReplayPath(DemoDriver);
+            const int64 Bytes = IFileManager::Get().FileSize(*Path);
+            const float Minutes = DemoDriver->GetDemoTotalTime() / 60.0f;
+            if (Bytes < 0)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("rmc.Replay.Stats: %s not found; only the local file streamer is supported"), *Path);
+                return;
+            }
+
+            UE_LOG(LogTemp, Display, TEXT("RMC replay %s: %.1f min, %.1f KB, %.1f KB/min"), *DemoDriver->GetActiveReplayName(), Minutes,
+                Bytes / 1024.0, Minutes > 0.0f ? Bytes / 1024.0 / Minutes : 0.0);
+        }));
+
+    static FAutoConsoleCommandWithWorldAndArgs ScrubCommand(
+        TEXT("rmc.Replay.ScrubTest"),
+        TEXT("While a replay plays, jumps to random times and logs how long each jump takes. Usage: rmc.Replay.ScrubTest [Jumps=20]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            UDemoNetDriver* DemoDriver = World ? World->GetDemoNetDriver() : nullptr;
+            if (!DemoDriver || !DemoDriver->IsPlaying())
+            {
+                UE_LOG(LogTemp, Warning, TEXT("rmc.Replay.ScrubTest: no replay is playing"));
+                return;
+            }
+
+            if (ScrubTest.DemoDriver.IsValid())
+            {
+                UE_LOG(LogTemp, Warning, TEXT("rmc.Replay.ScrubTest: already running"));
+                return;
+            }
+
+            ScrubTest = FScrubTest();
+            ScrubTest.DemoDriver = DemoDriver;
+            ScrubTest.Random.Initialize(1234);
+            ScrubTest.JumpsRemaining = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 20;
+            NextScrubJump();
+        }));
+}
@@ -0,0 +1,392 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCReplicationGraph.h"
+#include "ReplicationGraphTypes.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "Engine/ChildConnection.h"
+#include "Engine/NetDriver.h"
+#include "UObject/UObjectIterator.h"
+
+URMCReplicationGraph::URMCReplicationGraph()
+{
+    GridCellSize = 10000.0f;
+    SpatialBias = FVector2D(-200000.0f, -200000.0f);
+    FastMoverLookaheadSeconds = 0.5f;
+
+    // Matches URMCMovementComponent::GlobalSpeedCap
+    FastMoverMaxSpeed = 3000.0f;
+    FastMoverUpdateBudget = 0.0f;
+}
+
+void URMCReplicationGraph::InitGlobalActorClassSettings()
+{
+    Super::InitGlobalActorClassSettings();
+
+    // Blueprint and later-loaded classes inherit from their closest native parent
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        UClass* Class = *It;
+        if (!Class->IsNative() || Class->HasAnyClassFlags(CLASS_Abstract) || !Class->IsChildOf(AActor::StaticClass()))
+        {
+            continue;
+        }
+
+        const AActor* ActorCDO = Class->GetDefaultObject<AActor>();
+        if (!ActorCDO->GetIsReplicated())
+        {
+            continue;
+        }
+
+        const ERMCClassRepNodeMapping Policy = ComputeMappingPolicy(Class);
+        ClassRepNodePolicies.Set(Class, Policy);
+
+        FClassReplicationInfo ClassInfo;
+        ClassInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(ActorCDO->NetUpdateFrequency);
+
+        // The fast mover node does the precise path check, so the engine's own distance cull
+        // must not reject a pawn that is still out of range but heading in at full speed
+        float CullDistance = FMath::Sqrt(ActorCDO->NetCullDistanceSquared);
+        if (Policy == ERMCClassRepNodeMapping::FastMover)
+        {
+            CullDistance += FastMoverMaxSpeed * FastMoverLookaheadSeconds;
+        }
+        ClassInfo.SetCullDistanceSquared(FMath::Square(CullDistance));
+
+        GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+    }
+}
+
+void URMCReplicationGraph::InitGlobalGraphNodes()
+{
+    GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+    GridNode->CellSize = GridCellSize;
+    GridNode->SpatialBias = SpatialBias;
+    AddGlobalGraphNode(GridNode);
+
+    AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+    AddGlobalGraphNode(AlwaysRelevantNode);
+
+    FastMoverNode = CreateNewNode<URMCReplicationGraphNode_FastMovers>();
+    FastMoverNode->LookaheadSeconds = FastMoverLookaheadSeconds;
+    FastMoverNode->UpdateBudget = FastMoverUpdateBudget;
+    FastMoverNode->ServerTickRate = NetDriver ? NetDriver->GetNetServerMaxTickRate() : 30.0f;
+    AddGlobalGraphNode(FastMoverNode);
+
+    // Spreads player state updates over several frames instead of sending all of them every frame
+    UReplicationGraphNode_PlayerStateFrequencyLimiter* PlayerStateNode = CreateNewNode<UReplicationGraphNode_PlayerStateFrequencyLimiter>();
+    AddGlobalGraphNode(PlayerStateNode);
+}
+
+void URMCReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+    Super::InitConnectionGraphNodes(RepGraphConnection);
+
+    // The connection's own controller and view target, and the owner-only actors it owns
+    UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+    AddConnectionGraphNode(ConnectionNode, RepGraphConnection);
+    ConnectionNodes.Add(RepGraphConnection->NetConnection, ConnectionNode);
+
+    // Owner-only actors may have been waiting for this connection
+    RouteOwnerOnlyActors();
+}
+
+void URMCReplicationGraph::RemoveClientConnection(UNetConnection* NetConnection)
+{
+    UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = nullptr;
+    ConnectionNodes.RemoveAndCopyValue(NetConnection, ConnectionNode);
+
+    // The node goes with the connection, so its actors wait for a new owner
+    if (ConnectionNode)
+    {
+        for (TPair<AActor*, UReplicationGraphNode_AlwaysRelevant_ForConnection*>& OwnerOnlyActor : OwnerOnlyActors)
+        {
+            if (OwnerOnlyActor.Value == ConnectionNode)
+            {
+                OwnerOnlyActor.Value = nullptr;
+            }
+        }
+    }
+
+    Super::RemoveClientConnection(NetConnection);
+}
+
+int32 URMCReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+    // Owners change at runtime, for example when a pawn is possessed after it spawned
+    RouteOwnerOnlyActors();
+
+    return Super::ServerReplicateActors(DeltaSeconds);
+}
+
+void URMCReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+    case ERMCClassRepNodeMapping::RelevantAllConnections:
+        AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::Spatialize_Static:
+        GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::Spatialize_Dynamic:
+        GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::Spatialize_Dormancy:
+        GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::FastMover:
+        FastMoverNode->NotifyAddNetworkActor(ActorInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::OwnerOnly:
+    {
+        UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = FindOwnerConnectionNode(ActorInfo.Actor);
+        if (ConnectionNode)
+        {
+            ConnectionNode->NotifyAddNetworkActor(ActorInfo);
+        }
+        OwnerOnlyActors.Add(ActorInfo.Actor, ConnectionNode);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void URMCReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+    case ERMCClassRepNodeMapping::RelevantAllConnections:
+        AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::Spatialize_Static:
+        GridNode->RemoveActor_Static(ActorInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::Spatialize_Dynamic:
+        GridNode->RemoveActor_Dynamic(ActorInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::Spatialize_Dormancy:
+        GridNode->RemoveActor_Dormancy(ActorInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::FastMover:
+        FastMoverNode->NotifyRemoveNetworkActor(ActorInfo);
+        break;
+
+    case ERMCClassRepNodeMapping::OwnerOnly:
+    {
+        UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = nullptr;
+        if (OwnerOnlyActors.RemoveAndCopyValue(ActorInfo.Actor, ConnectionNode) && ConnectionNode)
+        {
+            ConnectionNode->NotifyRemoveNetworkActor(ActorInfo);
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+ERMCClassRepNodeMapping URMCReplicationGraph::GetMappingPolicy(const UClass* Class)
+{
+    if (const ERMCClassRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class))
+    {
+        return *Policy;
+    }
+
+    const ERMCClassRepNodeMapping Policy = ComputeMappingPolicy(Class);
+    ClassRepNodePolicies.Set(Class, Policy);
+    return Policy;
+}
+
+ERMCClassRepNodeMapping URMCReplicationGraph::ComputeMappingPolicy(const UClass* Class) const
+{
+    const AActor* ActorCDO = Class ? Class->GetDefaultObject<AActor>() : nullptr;
+    if (!ActorCDO || !ActorCDO->GetIsReplicated())
+    {
+        return ERMCClassRepNodeMapping::NotRouted;
+    }
+
+    if (Class->IsChildOf(APawn::StaticClass()))
+    {
+        return ERMCClassRepNodeMapping::FastMover;
+    }
+
+    // Player states go through the frequency limiter, controllers through the connection node as its viewer
+    if (Class->IsChildOf(APlayerState::StaticClass()) || Class->IsChildOf(APlayerController::StaticClass()))
+    {
+        return ERMCClassRepNodeMapping::NotRouted;
+    }
+
+    if (ActorCDO->bOnlyRelevantToOwner)
+    {
+        return ERMCClassRepNodeMapping::OwnerOnly;
+    }
+
+    if (ActorCDO->bAlwaysRelevant)
+    {
+        return ERMCClassRepNodeMapping::RelevantAllConnections;
+    }
+
+    if (!ActorCDO->IsReplicatingMovement())
+    {
+        return ERMCClassRepNodeMapping::Spatialize_Static;
+    }
+
+    return ActorCDO->NetDormancy > DORM_Awake ? ERMCClassRepNodeMapping::Spatialize_Dormancy : ERMCClassRepNodeMapping::Spatialize_Dynamic;
+}
+
+UReplicationGraphNode_AlwaysRelevant_ForConnection* URMCReplicationGraph::FindOwnerConnectionNode(const AActor* Actor) const
+{
+    UNetConnection* NetConnection = Actor ? Actor->GetNetConnection() : nullptr;
+
+    // Split screen players share their parent's connection manager
+    if (const UChildConnection* ChildConnection = NetConnection ? NetConnection->GetUChildConnection() : nullptr)
+    {
+        NetConnection = ChildConnection->Parent;
+    }
+
+    const TObjectPtr<UReplicationGraphNode_AlwaysRelevant_ForConnection>* ConnectionNode = NetConnection ? ConnectionNodes.Find(NetConnection) : nullptr;
+    return ConnectionNode ? ConnectionNode->Get() : nullptr;
+}
+
+void URMCReplicationGraph::RouteOwnerOnlyActors()
+{
+    for (TPair<AActor*, UReplicationGraphNode_AlwaysRelevant_ForConnection*>& OwnerOnlyActor : OwnerOnlyActors)
+    {
+        UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = FindOwnerConnectionNode(OwnerOnlyActor.Key);
+        if (ConnectionNode == OwnerOnlyActor.Value)
+        {
+            continue;
+        }
+
+        const FNewReplicatedActorInfo ActorInfo(OwnerOnlyActor.Key);
+        if (OwnerOnlyActor.Value)
+        {
+            OwnerOnlyActor.Value->NotifyRemoveNetworkActor(ActorInfo);
+        }
+        if (ConnectionNode)
+        {
+            ConnectionNode->NotifyAddNetworkActor(ActorInfo);
+        }
+        OwnerOnlyActor.Value = ConnectionNode;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Fast movers
+
+URMCReplicationGraphNode_FastMovers::URMCReplicationGraphNode_FastMovers()
+{
+    bRequiresPrepareForReplicationCall = true;
+    LookaheadSeconds = 0.5f;
+    UpdateBudget = 0.0f;
+    ServerTickRate = 30.0f;
+}
+
+void URMCReplicationGraphNode_FastMovers::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+    FMover& Mover = Movers.AddDefaulted_GetRef();
+    Mover.Actor = ActorInfo.Actor;
+}
+
+bool URMCReplicationGraphNode_FastMovers::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+    const int32 Index = Movers.IndexOfByPredicate([&ActorInfo](const FMover& Mover) { return Mover.Actor == ActorInfo.Actor; });
+    if (Index == INDEX_NONE)
+    {
+        if (bWarnIfNotFound)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("URMCReplicationGraphNode_FastMovers: %s was never added"), *GetNameSafe(ActorInfo.Actor));
+        }
+        return false;
+    }
+
+    Movers.RemoveAtSwap(Index);
+    return true;
+}
+
+void URMCReplicationGraphNode_FastMovers::NotifyResetAllNetworkActors()
+{
+    Movers.Reset();
+}
+
+void URMCReplicationGraphNode_FastMovers::PrepareForReplication()
+{
+    // Once per frame rather than once per connection
+    float TotalFrequency = 0.0f;
+    for (FMover& Mover : Movers)
+    {
+        Mover.PathStart = Mover.Actor->GetActorLocation();
+        Mover.PathDelta = Mover.Actor->GetVelocity() * LookaheadSeconds;
+        Mover.CullDistanceSquared = Mover.Actor->NetCullDistanceSquared;
+        TotalFrequency += Mover.Actor->NetUpdateFrequency;
+    }
+
+    // Over budget, every pawn gives up the same share of its rate
+    const float BudgetScale = UpdateBudget > 0.0f && TotalFrequency > UpdateBudget ? UpdateBudget / TotalFrequency : 1.0f;
+
+    // Throttle through the graph's own period rather than by leaving pawns out of the gather. A pawn missing
+    // from the gather for longer than ActorChannelFrameTimeout has its actor channel closed.
+    for (FMover& Mover : Movers)
+    {
+        const float Frequency = Mover.Actor->NetUpdateFrequency;
+        const uint32 PeriodFrames = static_cast<uint32>(FMath::Max(1, FMath::RoundToInt(ServerTickRate / FMath::Max(Frequency * BudgetScale, 1.0f))));
+        GraphGlobals->GlobalActorReplicationInfoMap->Get(Mover.Actor).Settings.ReplicationPeriodFrame = PeriodFrames;
+
+        if (Frequency > Mover.UpdateFrequency)
+        {
+            Mover.Actor->ForceNetUpdate();
+        }
+        Mover.UpdateFrequency = Frequency;
+    }
+}
+
+void URMCReplicationGraphNode_FastMovers::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_RMCFastMovers_Gather);
+
+    // Connections are gathered and replicated one at a time, so one list serves them all
+    ReplicationActorList.Reset(Movers.Num());
+
+    for (const FMover& Mover : Movers)
+    {
+        for (const FNetViewer& Viewer : Params.Viewers)
+        {
+            const FVector Closest = FMath::ClosestPointOnSegment(Viewer.ViewLocation, Mover.PathStart, Mover.PathStart + Mover.PathDelta);
+            if (FVector::DistSquared(Closest, Viewer.ViewLocation) <= Mover.CullDistanceSquared)
+            {
+                ReplicationActorList.Add(Mover.Actor);
+                break;
+            }
+        }
+    }
+
+    if (ReplicationActorList.Num() > 0)
+    {
+        Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+    }
+}
+
+void URMCReplicationGraphNode_FastMovers::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+    DebugInfo.Log(NodeName);
+    DebugInfo.PushIndent();
+    for (const FMover& Mover : Movers)
+    {
+        DebugInfo.Log(FString::Printf(TEXT("%s  Lookahead: %.0f"), *GetNameSafe(Mover.Actor), Mover.PathDelta.Size()));
+    }
+    DebugInfo.PopIndent();
+}
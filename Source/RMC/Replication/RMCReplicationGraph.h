@@ -0,0 +1,156 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "RMCReplicationGraph.generated.h"
+
+class UReplicationGraphNode_GridSpatialization2D;
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_AlwaysRelevant_ForConnection;
+class URMCReplicationGraphNode_FastMovers;
+
+/** How the graph routes a replicated actor class */
+enum class ERMCClassRepNodeMapping : uint8
+{
+    // Handled by a per-connection node, or not replicated through the graph at all
+    NotRouted,
+
+    // Sent to every connection regardless of distance
+    RelevantAllConnections,
+
+    // Grid cells, never moves
+    Spatialize_Static,
+
+    // Grid cells, re-binned every frame
+    Spatialize_Dynamic,
+
+    // Grid cells, only re-binned while awake
+    Spatialize_Dormancy,
+
+    // Pawns, culled against their predicted path instead of their current cell
+    FastMover,
+
+    // Only sent to the owning connection, through that connection's always relevant node
+    OwnerOnly
+};
+
+/**
+ * Replication graph for large RMC servers. Level actors go into a 2D grid so each connection only
+ * looks at the cells around it. Pawns move fast enough to cross several cells between net updates,
+ * so they are culled against the segment they will travel over the next FastMoverLookaheadSeconds
+ * and become relevant before they arrive rather than popping in.
+ */
+UCLASS(Transient, Config = Engine)
+class RMC_API URMCReplicationGraph : public UReplicationGraph
+{
+    GENERATED_BODY()
+
+public:
+    URMCReplicationGraph();
+
+    virtual void InitGlobalActorClassSettings() override;
+    virtual void InitGlobalGraphNodes() override;
+    virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+    virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+    virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+    virtual void RemoveClientConnection(UNetConnection* NetConnection) override;
+    virtual int32 ServerReplicateActors(float DeltaSeconds) override;
+
+    /** Size of a grid cell in world units */
+    UPROPERTY(Config)
+    float GridCellSize;
+
+    /** Offset applied to actor locations so the grid starts at the world's minimum corner */
+    UPROPERTY(Config)
+    FVector2D SpatialBias;
+
+    /** How far ahead pawn relevancy is extended along the current velocity */
+    UPROPERTY(Config)
+    float FastMoverLookaheadSeconds;
+
+    /** Upper bound on pawn speed used to size the engine's own cull check, normally the movement speed cap */
+    UPROPERTY(Config)
+    float FastMoverMaxSpeed;
+
+    /** Pawn updates per second the server may send in total. Pawns are slowed evenly past it. 0 is unlimited. */
+    UPROPERTY(Config)
+    float FastMoverUpdateBudget;
+
+    UPROPERTY()
+    TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+    UPROPERTY()
+    TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+    UPROPERTY()
+    TObjectPtr<URMCReplicationGraphNode_FastMovers> FastMoverNode;
+
+private:
+    /** Cached policy for Class, computed on first use for classes loaded after startup */
+    ERMCClassRepNodeMapping GetMappingPolicy(const UClass* Class);
+
+    ERMCClassRepNodeMapping ComputeMappingPolicy(const UClass* Class) const;
+
+    /** Always relevant node of the connection that owns Actor, or nullptr while it has no owning connection */
+    UReplicationGraphNode_AlwaysRelevant_ForConnection* FindOwnerConnectionNode(const AActor* Actor) const;
+
+    /** Moves owner-only actors whose owning connection changed, or that only now have one, to the right node */
+    void RouteOwnerOnlyActors();
+
+    TClassMap<ERMCClassRepNodeMapping> ClassRepNodePolicies;
+
+    UPROPERTY()
+    TMap<TObjectPtr<UNetConnection>, TObjectPtr<UReplicationGraphNode_AlwaysRelevant_ForConnection>> ConnectionNodes;
+
+    // Every owner-only actor and the connection node it is in, nullptr while it has no owner to go to
+    TMap<AActor*, UReplicationGraphNode_AlwaysRelevant_ForConnection*> OwnerOnlyActors;
+};
+
+/**
+ * Pawns relevant to a connection because the viewer lies within cull distance of the segment from the
+ * pawn's location to where its velocity takes it within the lookahead. A stationary pawn reduces to an
+ * ordinary distance check. Every pawn is gathered every frame. Its replication period follows its own
+ * NetUpdateFrequency, which URMCMovementComponent adapts to movement state.
+ */
+UCLASS()
+class RMC_API URMCReplicationGraphNode_FastMovers : public UReplicationGraphNode
+{
+    GENERATED_BODY()
+
+public:
+    URMCReplicationGraphNode_FastMovers();
+
+    virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+    virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+    virtual void NotifyResetAllNetworkActors() override;
+    virtual void PrepareForReplication() override;
+    virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+    virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+
+    float LookaheadSeconds;
+
+    float UpdateBudget;
+
+    // Frames per second the net driver replicates at
+    float ServerTickRate;
+
+private:
+    struct FMover
+    {
+        AActor* Actor = nullptr;
+
+        // Path over the lookahead, refreshed once per frame
+        FVector PathStart = FVector::ZeroVector;
+        FVector PathDelta = FVector::ZeroVector;
+        float CullDistanceSquared = 0.0f;
+
+        // Rate last frame, so a raised rate can send at once
+        float UpdateFrequency = 0.0f;
+    };
+
+    TArray<FMover> Movers;
+
+    FActorRepListRefView ReplicationActorList;
+};
@@ -0,0 +1,411 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCRollbackSubsystem.h"
+#include "../RMCCharacter.h"
+#include "../RMCPlayerController.h"
+#include "../Components/Movement/RMCMovementComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+URMCRollbackSubsystem::URMCRollbackSubsystem()
+{
+    FixedTickRate = 60.0f;
+    InputRedundancy = 8;
+    // Leaves 15 of the ring's slots for inputs from peers running up to a quarter second ahead
+    MaxRollbackFrames = FRMCRollbackHistory::Capacity - 16;
+    SessionStartDelay = 0.25f;
+
+    SessionStartTime = 0.0;
+    CurrentFrame = 0;
+    PendingRollbackFrame = INDEX_NONE;
+    bSessionActive = false;
+}
+
+void URMCRollbackSubsystem::Deinitialize()
+{
+    StopSession();
+
+    Super::Deinitialize();
+}
+
+TStatId URMCRollbackSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(URMCRollbackSubsystem, STATGROUP_Tickables);
+}
+
+void URMCRollbackSubsystem::StartSession()
+{
+    const UWorld* World = GetWorld();
+    if (bSessionActive || !World)
+    {
+        return;
+    }
+
+    // A client starting on its own has nobody to wait for
+    StartSessionAt(GetServerTime() + (World->GetNetMode() == NM_Client ? 0.0 : SessionStartDelay));
+}
+
+void URMCRollbackSubsystem::StartSessionAt(double StartServerTime)
+{
+    if (bSessionActive)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // Clients follow the server into the session, at the same frame 0
+    if (World->GetNetMode() != NM_Client)
+    {
+        for (TActorIterator<ARMCPlayerController> It(World); It; ++It)
+        {
+            if (!It->IsLocalController())
+            {
+                It->ClientStartRollbackSession(StartServerTime);
+            }
+        }
+    }
+
+    Participants.Reset();
+    for (TActorIterator<ARMCCharacter> It(World); It; ++It)
+    {
+        ARMCCharacter* Character = *It;
+        if (!Character->GetPlayerState() || !Character->GetRMCMovementComponent())
+        {
+            continue;
+        }
+
+        FParticipant& Participant = Participants.AddDefaulted_GetRef();
+        Participant.Character = Character;
+        Participant.PlayerId = Character->GetPlayerState()->GetPlayerId();
+        Participant.bLocal = Character->IsLocallyControlled();
+        Participant.History = MakeUnique<FRMCRollbackHistory>();
+
+        Character->SetRollbackControlled(true);
+    }
+
+    // Every peer must step characters in the same order
+    Participants.Sort([](const FParticipant& A, const FParticipant& B) { return A.PlayerId < B.PlayerId; });
+
+    SessionStartTime = StartServerTime;
+    CurrentFrame = 0;
+    PendingRollbackFrame = INDEX_NONE;
+    bSessionActive = true;
+    ResetStats();
+
+    UE_LOG(LogTemp, Display, TEXT("Rollback session started with %d characters at %.0f Hz, frame 0 at server time %.3f"),
+        Participants.Num(), FixedTickRate, StartServerTime);
+}
+
+void URMCRollbackSubsystem::StopSession()
+{
+    if (!bSessionActive)
+    {
+        return;
+    }
+
+    for (FParticipant& Participant : Participants)
+    {
+        if (ARMCCharacter* Character = Participant.Character.Get())
+        {
+            Character->SetRollbackControlled(false);
+        }
+    }
+
+    Participants.Reset();
+    bSessionActive = false;
+}
+
+void URMCRollbackSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!bSessionActive || FixedTickRate <= 0.0f)
+    {
+        return;
+    }
+
+    // Characters that left the match drop out
+    Participants.RemoveAll([](const FParticipant& Participant) { return !Participant.Character.IsValid(); });
+
+    if (PendingRollbackFrame != INDEX_NONE)
+    {
+        Rollback(PendingRollbackFrame);
+        PendingRollbackFrame = INDEX_NONE;
+    }
+
+    // Frames completed by now on the shared clock. Characters hold still until frame 0 starts.
+    const int32 TargetFrame = FMath::FloorToInt32((GetServerTime() - SessionStartTime) * FixedTickRate);
+
+    // Cap the catch-up so a hitch doesn't turn into a spiral; the rest is made up over the next ticks
+    int32 StepsThisTick = 0;
+    while (CurrentFrame < TargetFrame && StepsThisTick < 4)
+    {
+        AdvanceFrame();
+        ++StepsThisTick;
+    }
+}
+
+double URMCRollbackSubsystem::GetServerTime() const
+{
+    const UWorld* World = GetWorld();
+    const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+    return GameState ? GameState->GetServerWorldTimeSeconds() : (World ? World->GetTimeSeconds() : 0.0);
+}
+
+void URMCRollbackSubsystem::AdvanceFrame()
+{
+    const int32 Frame = CurrentFrame;
+
+    for (FParticipant& Participant : Participants)
+    {
+        ARMCCharacter* Character = Participant.Character.Get();
+        FRMCRollbackHistory& History = *Participant.History;
+
+        // State at the start of the frame, for rolling back to it later
+        Character->GetRMCMovementComponent()->CaptureSnapshot(History.Snapshots[FRMCRollbackHistory::ToIndex(Frame)]);
+
+        if (Participant.bLocal)
+        {
+            History.SetInput(Frame, Character->SampleRollbackInput(), true);
+        }
+        else if (!History.IsConfirmed(Frame))
+        {
+            History.SetInput(Frame, History.LastConfirmedInput.MakePrediction(), false);
+        }
+    }
+
+    SimulateFrame(Frame, false);
+
+    for (const FParticipant& Participant : Participants)
+    {
+        if (Participant.bLocal)
+        {
+            SendLocalInputs(Participant);
+        }
+    }
+
+    ++CurrentFrame;
+}
+
+void URMCRollbackSubsystem::SimulateFrame(int32 Frame, bool bResimulating)
+{
+    const float FixedDeltaTime = 1.0f / FixedTickRate;
+
+    for (FParticipant& Participant : Participants)
+    {
+        ARMCCharacter* Character = Participant.Character.Get();
+        const FRMCRollbackInput* Input = Participant.History->FindInput(Frame);
+        if (!Character || !Input)
+        {
+            continue;
+        }
+
+        Character->ApplyRollbackInput(*Input, bResimulating);
+        Character->TryWallRun();
+        Character->GetRMCMovementComponent()->RollbackSimulateStep(Input->GetMoveInput(), FixedDeltaTime);
+    }
+}
+
+void URMCRollbackSubsystem::Rollback(int32 ToFrame)
+{
+    const int32 OldestFrame = FMath::Max(CurrentFrame - MaxRollbackFrames, 0);
+    if (ToFrame < OldestFrame)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Rollback to frame %d is past the %d frame history, resimulating from %d; peers may diverge"),
+            ToFrame, MaxRollbackFrames, OldestFrame);
+        ToFrame = OldestFrame;
+    }
+
+    if (ToFrame >= CurrentFrame)
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    for (FParticipant& Participant : Participants)
+    {
+        URMCMovementComponent* MovementComponent = Participant.Character->GetRMCMovementComponent();
+        MovementComponent->RestoreSnapshot(Participant.History->Snapshots[FRMCRollbackHistory::ToIndex(ToFrame)]);
+        MovementComponent->SetMovementEventsSuppressed(true);
+    }
+
+    // Unconfirmed frames are predicted again from the newest confirmed input before them
+    TArray<FRMCRollbackInput, TInlineAllocator<4>> PredictionBases;
+    for (const FParticipant& Participant : Participants)
+    {
+        const FRMCRollbackHistory& History = *Participant.History;
+        const FRMCRollbackInput* Previous = History.IsConfirmed(ToFrame - 1) ? History.FindInput(ToFrame - 1) : nullptr;
+        PredictionBases.Add(Previous ? *Previous : History.LastConfirmedInput);
+    }
+
+    for (int32 Frame = ToFrame; Frame < CurrentFrame; ++Frame)
+    {
+        for (int32 Index = 0; Index < Participants.Num(); ++Index)
+        {
+            FParticipant& Participant = Participants[Index];
+            FRMCRollbackHistory& History = *Participant.History;
+
+            if (Frame != ToFrame)
+            {
+                Participant.Character->GetRMCMovementComponent()->CaptureSnapshot(History.Snapshots[FRMCRollbackHistory::ToIndex(Frame)]);
+            }
+
+            if (History.IsConfirmed(Frame))
+            {
+                PredictionBases[Index] = *History.FindInput(Frame);
+            }
+            else
+            {
+                History.SetInput(Frame, PredictionBases[Index].MakePrediction(), false);
+            }
+        }
+
+        SimulateFrame(Frame, true);
+    }
+
+    for (FParticipant& Participant : Participants)
+    {
+        Participant.Character->GetRMCMovementComponent()->SetMovementEventsSuppressed(false);
+    }
+
+    const double Elapsed = FPlatformTime::Seconds() - StartTime;
+    const int32 NumFrames = CurrentFrame - ToFrame;
+
+    ++Stats.Rollbacks;
+    Stats.FramesResimulated += NumFrames;
+    Stats.TotalResimSeconds += Elapsed;
+    Stats.MaxRollbackSeconds = FMath::Max(Stats.MaxRollbackSeconds, Elapsed);
+    Stats.MaxRollbackFrames = FMath::Max(Stats.MaxRollbackFrames, NumFrames);
+}
+
+void URMCRollbackSubsystem::ReceiveInputPacket(const FRMCRollbackInputPacket& Packet)
+{
+    FParticipant* Participant = FindParticipant(Packet.PlayerId);
+    if (!bSessionActive || !Participant || Participant->bLocal)
+    {
+        return;
+    }
+
+    FRMCRollbackHistory& History = *Participant->History;
+    const int32 OldestFrame = CurrentFrame - MaxRollbackFrames;
+
+    // Frames past the newest the ring can hold come again in later packets, thanks to InputRedundancy
+    const int32 NumInputs = FMath::Min(Packet.Inputs.Num(), FMath::Max(OldestFrame + FRMCRollbackHistory::Capacity - Packet.FirstFrame, 0));
+    Stats.EarlyInputsDropped += Packet.Inputs.Num() - NumInputs;
+
+    for (int32 Offset = 0; Offset < NumInputs; ++Offset)
+    {
+        const int32 Frame = Packet.FirstFrame + Offset;
+
+        switch (History.ReceiveRemoteInput(Frame, Packet.Inputs[Offset], OldestFrame, CurrentFrame))
+        {
+        case ERMCRemoteInputResult::Mispredicted:
+            ++Stats.Mispredictions;
+            PendingRollbackFrame = PendingRollbackFrame == INDEX_NONE ? Frame : FMath::Min(PendingRollbackFrame, Frame);
+            break;
+
+        case ERMCRemoteInputResult::TooLate:
+            ++Stats.LateInputsDropped;
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+void URMCRollbackSubsystem::SendLocalInputs(const FParticipant& Participant) const
+{
+    const ARMCCharacter* Character = Participant.Character.Get();
+    ARMCPlayerController* Controller = Character ? Cast<ARMCPlayerController>(Character->GetController()) : nullptr;
+    if (!Controller)
+    {
+        return;
+    }
+
+    FRMCRollbackInputPacket Packet;
+    Packet.PlayerId = Participant.PlayerId;
+    Packet.FirstFrame = FMath::Max(CurrentFrame - InputRedundancy + 1, 0);
+    Packet.Inputs.Reserve(CurrentFrame - Packet.FirstFrame + 1);
+
+    for (int32 Frame = Packet.FirstFrame; Frame <= CurrentFrame; ++Frame)
+    {
+        const FRMCRollbackInput* Input = Participant.History->FindInput(Frame);
+        Packet.Inputs.Add(Input ? *Input : FRMCRollbackInput());
+    }
+
+    Controller->ServerSendRollbackInputs(Packet);
+}
+
+URMCRollbackSubsystem::FParticipant* URMCRollbackSubsystem::FindParticipant(int32 PlayerId)
+{
+    return Participants.FindByPredicate([PlayerId](const FParticipant& Participant) { return Participant.PlayerId == PlayerId; });
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Console commands
+
+namespace RMCRollbackCommands
+{
+    static URMCRollbackSubsystem* GetSubsystem(UWorld* World)
+    {
+        return World ? World->GetSubsystem<URMCRollbackSubsystem>() : nullptr;
+    }
+
+    static FAutoConsoleCommandWithWorldAndArgs StartCommand(
+        TEXT("rmc.Rollback.Start"),
+        TEXT("Starts a rollback session for every player character. Run on the server."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            if (URMCRollbackSubsystem* Subsystem = GetSubsystem(World))
+            {
+                Subsystem->StartSession();
+            }
+        }));
+
+    static FAutoConsoleCommandWithWorldAndArgs StopCommand(
+        TEXT("rmc.Rollback.Stop"),
+        TEXT("Ends the rollback session on this peer"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            if (URMCRollbackSubsystem* Subsystem = GetSubsystem(World))
+            {
+                Subsystem->StopSession();
+            }
+        }));
+
+    static FAutoConsoleCommandWithWorldAndArgs StatsCommand(
+        TEXT("rmc.Rollback.Stats"),
+        TEXT("Logs rollback counts and resimulation cost. Pass 'reset' to clear them."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            URMCRollbackSubsystem* Subsystem = GetSubsystem(World);
+            if (!Subsystem)
+            {
+                return;
+            }
+
+            const FRMCRollbackStats& Stats = Subsystem->GetStats();
+            UE_LOG(LogTemp, Display, TEXT("Rollback: frame %d, %d rollbacks, %lld frames resimulated (max %d in one rollback)"),
+                Subsystem->GetCurrentFrame(), Stats.Rollbacks, Stats.FramesResimulated, Stats.MaxRollbackFrames);
+            UE_LOG(LogTemp, Display, TEXT("  Resim cost: %.2f us per frame average, %.3f ms worst rollback"),
+                Stats.GetAverageResimFrameMicroseconds(), Stats.MaxRollbackSeconds * 1000.0);
+            UE_LOG(LogTemp, Display, TEXT("  Mispredicted inputs: %d, inputs too late to apply: %d, too far ahead: %d"),
+                Stats.Mispredictions, Stats.LateInputsDropped, Stats.EarlyInputsDropped);
+
+            if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+            {
+                Subsystem->ResetStats();
+            }
+        }));
+}
@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RMCRollbackTypes.h"
+#include "RMCRollbackSubsystem.generated.h"
+
+class ARMCCharacter;
+
+/**
+ * Resimulation cost and prediction quality since the session started
+ */
+struct RMC_API FRMCRollbackStats
+{
+    int32 Rollbacks = 0;
+    int64 FramesResimulated = 0;
+    int32 MaxRollbackFrames = 0;
+    double TotalResimSeconds = 0.0;
+    double MaxRollbackSeconds = 0.0;
+
+    // Remote inputs that differed from the prediction, ones too old to roll back to, and ones too far ahead to store
+    int32 Mispredictions = 0;
+    int32 LateInputsDropped = 0;
+    int32 EarlyInputsDropped = 0;
+
+    double GetAverageResimFrameMicroseconds() const
+    {
+        return FramesResimulated > 0 ? TotalResimSeconds * 1e6 / FramesResimulated : 0.0;
+    }
+};
+
+/**
+ * Rollback netcode for small competitive matches. Every peer steps every RMC character at a fixed rate.
+ * Local input is applied the frame it is sampled, so there is no added input latency. Remote input is
+ * predicted by repeating the last known input. When the real input arrives and differs, every character
+ * is restored to the snapshot before that frame and the frames since are resimulated.
+ */
+UCLASS()
+class RMC_API URMCRollbackSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    URMCRollbackSubsystem();
+
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * Starts stepping every player-owned ARMCCharacter through the rollback loop. On the server frame 0
+     * is SessionStartDelay from now, and every client is told the same server time.
+     */
+    void StartSession();
+
+    /**
+     * Starts the session with frame 0 at StartServerTime, in the game state's server world time. Each
+     * peer then steps to the frame that time says, so frame numbers line up whatever the peer's latency.
+     */
+    void StartSessionAt(double StartServerTime);
+
+    /** Hands the characters back to normal movement */
+    void StopSession();
+
+    bool IsSessionActive() const { return bSessionActive; }
+
+    /** Takes inputs another peer sent for its player */
+    void ReceiveInputPacket(const FRMCRollbackInputPacket& Packet);
+
+    int32 GetCurrentFrame() const { return CurrentFrame; }
+
+    const FRMCRollbackStats& GetStats() const { return Stats; }
+
+    void ResetStats() { Stats = FRMCRollbackStats(); }
+
+    /** Simulation frames per second */
+    float FixedTickRate;
+
+    /** How many past frames of local input each packet repeats */
+    int32 InputRedundancy;
+
+    /**
+     * Most frames a single rollback may resimulate. The input ring holds these past frames, and the rest of
+     * its slots take inputs that arrive ahead of the current frame.
+     */
+    int32 MaxRollbackFrames;
+
+    /** Seconds between the server starting a session and frame 0, long enough for the start to reach every client */
+    float SessionStartDelay;
+
+private:
+    struct FParticipant
+    {
+        TWeakObjectPtr<ARMCCharacter> Character;
+        int32 PlayerId = INDEX_NONE;
+        bool bLocal = false;
+        TUniquePtr<FRMCRollbackHistory> History;
+    };
+
+    /** Snapshots, gathers input for and simulates CurrentFrame, then moves on */
+    void AdvanceFrame();
+
+    /** Server world time on this peer, which the game state keeps in step with the server's */
+    double GetServerTime() const;
+
+    /** Steps every character once with the inputs recorded for Frame */
+    void SimulateFrame(int32 Frame, bool bResimulating);
+
+    /** Restores the snapshot at ToFrame and resimulates up to the current frame */
+    void Rollback(int32 ToFrame);
+
+    void SendLocalInputs(const FParticipant& Participant) const;
+
+    FParticipant* FindParticipant(int32 PlayerId);
+
+    TArray<FParticipant> Participants;
+
+    // Server world time of frame 0
+    double SessionStartTime;
+    int32 CurrentFrame;
+
+    // Earliest frame whose inputs changed after it was simulated, or INDEX_NONE
+    int32 PendingRollbackFrame;
+
+    bool bSessionActive;
+
+    FRMCRollbackStats Stats;
+};
@@ -0,0 +1,191 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCRollbackSubsystem.h"
+#include "RMCRollbackTypes.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RMCRollbackTests
+{
+    /** Order-sensitive stand-in for a movement step, so any wrong or misplaced input shows in the end state */
+    static float StepState(float State, const FRMCRollbackInput& Input)
+    {
+        return State * 0.9f + Input.MoveX;
+    }
+
+    /** The input the remote player really pressed on Frame, changing every few frames so guesses go wrong */
+    static FRMCRollbackInput MakeTrueInput(int32 Frame)
+    {
+        FRMCRollbackInput Input;
+        Input.MoveX = static_cast<int8>((Frame / 5) * 37 % 101 - 50);
+        return Input;
+    }
+
+    /**
+     * One peer stepping a single remote player the way URMCRollbackSubsystem steps its participants:
+     * snapshot, predict, simulate, and roll back when a confirmed input disagrees with the guess.
+     */
+    struct FTestPeer
+    {
+        FRMCRollbackHistory History;
+        float Snapshots[FRMCRollbackHistory::Capacity] = {};
+        float State = 0.0f;
+        int32 CurrentFrame = 0;
+        int32 PendingRollbackFrame = INDEX_NONE;
+        int32 MaxRollbackFrames = 0;
+        int32 EarlyInputsDropped = 0;
+
+        void Receive(const FRMCRollbackInputPacket& Packet)
+        {
+            const int32 OldestFrame = CurrentFrame - MaxRollbackFrames;
+            const int32 NumInputs = FMath::Min(Packet.Inputs.Num(), FMath::Max(OldestFrame + FRMCRollbackHistory::Capacity - Packet.FirstFrame, 0));
+            EarlyInputsDropped += Packet.Inputs.Num() - NumInputs;
+
+            for (int32 Offset = 0; Offset < NumInputs; ++Offset)
+            {
+                const int32 Frame = Packet.FirstFrame + Offset;
+                if (History.ReceiveRemoteInput(Frame, Packet.Inputs[Offset], OldestFrame, CurrentFrame) == ERMCRemoteInputResult::Mispredicted)
+                {
+                    PendingRollbackFrame = PendingRollbackFrame == INDEX_NONE ? Frame : FMath::Min(PendingRollbackFrame, Frame);
+                }
+            }
+        }
+
+        void Tick()
+        {
+            if (PendingRollbackFrame != INDEX_NONE)
+            {
+                Rollback(PendingRollbackFrame);
+                PendingRollbackFrame = INDEX_NONE;
+            }
+
+            Snapshots[FRMCRollbackHistory::ToIndex(CurrentFrame)] = State;
+            if (!History.IsConfirmed(CurrentFrame))
+            {
+                History.SetInput(CurrentFrame, History.LastConfirmedInput.MakePrediction(), false);
+            }
+
+            State = StepState(State, *History.FindInput(CurrentFrame));
+            ++CurrentFrame;
+        }
+
+        void Rollback(int32 ToFrame)
+        {
+            ToFrame = FMath::Max(ToFrame, FMath::Max(CurrentFrame - MaxRollbackFrames, 0));
+            if (ToFrame >= CurrentFrame)
+            {
+                return;
+            }
+
+            State = Snapshots[FRMCRollbackHistory::ToIndex(ToFrame)];
+
+            const FRMCRollbackInput* Previous = History.IsConfirmed(ToFrame - 1) ? History.FindInput(ToFrame - 1) : nullptr;
+            FRMCRollbackInput PredictionBase = Previous ? *Previous : History.LastConfirmedInput;
+
+            for (int32 Frame = ToFrame; Frame < CurrentFrame; ++Frame)
+            {
+                Snapshots[FRMCRollbackHistory::ToIndex(Frame)] = State;
+
+                if (History.IsConfirmed(Frame))
+                {
+                    PredictionBase = *History.FindInput(Frame);
+                }
+                else
+                {
+                    History.SetInput(Frame, PredictionBase.MakePrediction(), false);
+                }
+
+                State = StepState(State, *History.FindInput(Frame));
+            }
+        }
+    };
+
+    static FRMCRollbackInputPacket MakePacket(int32 FirstFrame, int32 NumFrames)
+    {
+        FRMCRollbackInputPacket Packet;
+        Packet.PlayerId = 1;
+        Packet.FirstFrame = FirstFrame;
+        for (int32 Frame = FirstFrame; Frame < FirstFrame + NumFrames; ++Frame)
+        {
+            Packet.Inputs.Add(MakeTrueInput(Frame));
+        }
+        return Packet;
+    }
+}
+
+using namespace RMCRollbackTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRMCRollbackEarlyInputsTest, "RMC.Rollback.EarlyInputsKeepRollbackWindow",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRMCRollbackEarlyInputsTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumFrames = 160;
+    constexpr int32 Latency = 10;
+    constexpr int32 EarlyPacketFrame = 60;
+
+    FTestPeer Peer;
+    Peer.MaxRollbackFrames = GetDefault<URMCRollbackSubsystem>()->MaxRollbackFrames;
+
+    if (!TestTrue(TEXT("Rollback window leaves room in the ring for early inputs"), Peer.MaxRollbackFrames < FRMCRollbackHistory::Capacity - 1))
+    {
+        return false;
+    }
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        // The remote player's inputs turn up late, repeated as the subsystem sends them
+        if (Frame >= Latency)
+        {
+            Peer.Receive(MakePacket(FMath::Max(Frame - Latency - 7, 0), FMath::Min(Frame - Latency + 1, 8)));
+        }
+
+        // A peer running far ahead sends more frames than the ring can hold past the rollback window
+        if (Frame == EarlyPacketFrame)
+        {
+            const int32 OldestFrame = Frame - Peer.MaxRollbackFrames;
+            const int32 NumEarly = FRMCRollbackHistory::Capacity + 5;
+            Peer.Receive(MakePacket(Frame, NumEarly));
+
+            TestEqual(TEXT("Early inputs past the ring are dropped"), Peer.EarlyInputsDropped, Frame + NumEarly - (OldestFrame + FRMCRollbackHistory::Capacity));
+            TestTrue(TEXT("Early input inside the ring is kept"), Peer.History.IsConfirmed(OldestFrame + FRMCRollbackHistory::Capacity - 1));
+
+            // The oldest frame a rollback may still restore keeps its own input
+            const FRMCRollbackInput* OldestInput = Peer.History.FindInput(OldestFrame);
+            TestTrue(TEXT("Oldest frame in the window keeps its input slot"), OldestInput != nullptr);
+        }
+
+        Peer.Tick();
+    }
+
+    // Everything still in flight arrives, and the last rollback settles the state
+    Peer.Receive(MakePacket(NumFrames - Latency - 7, Latency + 7));
+    if (Peer.PendingRollbackFrame != INDEX_NONE)
+    {
+        Peer.Rollback(Peer.PendingRollbackFrame);
+    }
+
+    float Expected = 0.0f;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Expected = StepState(Expected, MakeTrueInput(Frame));
+    }
+
+    TestEqual(TEXT("Resimulated state matches the true inputs"), Peer.State, Expected);
+
+    for (int32 Frame = NumFrames - Peer.MaxRollbackFrames; Frame < NumFrames; ++Frame)
+    {
+        const FRMCRollbackInput* Input = Peer.History.FindInput(Frame);
+        if (!TestTrue(FString::Printf(TEXT("Frame %d has a confirmed input"), Frame), Input && Peer.History.IsConfirmed(Frame)))
+        {
+            break;
+        }
+
+        TestTrue(FString::Printf(TEXT("Frame %d kept the true input"), Frame), *Input == MakeTrueInput(Frame));
+    }
+
+    return true;
+}
+
+#endif
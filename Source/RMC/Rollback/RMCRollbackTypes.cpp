@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCRollbackTypes.h"
+
+FRMCRollbackInput FRMCRollbackInput::Make(const FVector& MoveInput, uint8 InButtons)
+{
+    const FVector Clamped = MoveInput.GetClampedToMaxSize(1.0f);
+
+    FRMCRollbackInput Input;
+    Input.MoveX = static_cast<int8>(FMath::RoundToInt(Clamped.X * 127.0f));
+    Input.MoveY = static_cast<int8>(FMath::RoundToInt(Clamped.Y * 127.0f));
+    Input.Buttons = InButtons;
+    return Input;
+}
+
+FRMCRollbackInput FRMCRollbackInput::MakePrediction() const
+{
+    FRMCRollbackInput Prediction = *this;
+    Prediction.Buttons &= ~ERMCRollbackButtons::EdgeMask;
+    return Prediction;
+}
+
+FRMCRollbackHistory::FRMCRollbackHistory()
+{
+    for (int32 Index = 0; Index < Capacity; ++Index)
+    {
+        InputFrames[Index] = INDEX_NONE;
+        bInputConfirmed[Index] = false;
+    }
+}
+
+const FRMCRollbackInput* FRMCRollbackHistory::FindInput(int32 Frame) const
+{
+    const int32 Index = ToIndex(Frame);
+    return InputFrames[Index] == Frame ? &Inputs[Index] : nullptr;
+}
+
+void FRMCRollbackHistory::SetInput(int32 Frame, const FRMCRollbackInput& Input, bool bConfirmed)
+{
+    const int32 Index = ToIndex(Frame);
+    Inputs[Index] = Input;
+    InputFrames[Index] = Frame;
+    bInputConfirmed[Index] = bConfirmed;
+
+    if (bConfirmed && Frame > LastConfirmedFrame)
+    {
+        LastConfirmedFrame = Frame;
+        LastConfirmedInput = Input;
+    }
+}
+
+ERMCRemoteInputResult FRMCRollbackHistory::ReceiveRemoteInput(int32 Frame, const FRMCRollbackInput& Input, int32 OldestFrame, int32 CurrentFrame)
+{
+    if (Frame >= OldestFrame + Capacity)
+    {
+        return ERMCRemoteInputResult::TooEarly;
+    }
+
+    if (IsConfirmed(Frame))
+    {
+        return ERMCRemoteInputResult::AlreadyConfirmed;
+    }
+
+    if (Frame < OldestFrame)
+    {
+        return ERMCRemoteInputResult::TooLate;
+    }
+
+    // Frames already simulated with a wrong guess need redoing
+    const FRMCRollbackInput* Predicted = FindInput(Frame);
+    const bool bMispredicted = Frame < CurrentFrame && (!Predicted || *Predicted != Input);
+
+    SetInput(Frame, Input, true);
+    return bMispredicted ? ERMCRemoteInputResult::Mispredicted : ERMCRemoteInputResult::Stored;
+}
@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Components/Movement/RMCMovementSnapshot.h"
+#include "RMCRollbackTypes.generated.h"
+
+/**
+ * Button bits carried in FRMCRollbackInput. Presses and releases are edges, so a predicted input
+ * simply drops them.
+ */
+namespace ERMCRollbackButtons
+{
+    enum Type : uint8
+    {
+        JumpPressed = 1 << 0,
+        JumpReleased = 1 << 1,
+        DashPressed = 1 << 2,
+        SlidePressed = 1 << 3,
+        SlideReleased = 1 << 4,
+
+        EdgeMask = JumpPressed | JumpReleased | DashPressed | SlidePressed | SlideReleased
+    };
+}
+
+/**
+ * One frame of player input, quantized so it is cheap to send and compares exactly
+ */
+USTRUCT()
+struct RMC_API FRMCRollbackInput
+{
+    GENERATED_BODY()
+
+    // World-space movement input, scaled to [-127, 127]
+    UPROPERTY()
+    int8 MoveX = 0;
+
+    UPROPERTY()
+    int8 MoveY = 0;
+
+    UPROPERTY()
+    uint8 Buttons = 0;
+
+    static FRMCRollbackInput Make(const FVector& MoveInput, uint8 InButtons);
+
+    FVector GetMoveInput() const { return FVector(MoveX / 127.0f, MoveY / 127.0f, 0.0f); }
+
+    /** Guess for a frame whose input hasn't arrived: keep moving the same way, press nothing new */
+    FRMCRollbackInput MakePrediction() const;
+
+    bool operator==(const FRMCRollbackInput& Other) const
+    {
+        return MoveX == Other.MoveX && MoveY == Other.MoveY && Buttons == Other.Buttons;
+    }
+
+    bool operator!=(const FRMCRollbackInput& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Inputs for consecutive frames from one player. Each packet repeats the last few frames so a lost
+ * packet costs nothing as long as a later one arrives.
+ */
+USTRUCT()
+struct RMC_API FRMCRollbackInputPacket
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 PlayerId = INDEX_NONE;
+
+    UPROPERTY()
+    int32 FirstFrame = 0;
+
+    UPROPERTY()
+    TArray<FRMCRollbackInput> Inputs;
+};
+
+/**
+ * What FRMCRollbackHistory::ReceiveRemoteInput did with an input
+ */
+enum class ERMCRemoteInputResult : uint8
+{
+    // Confirmed, and either not simulated yet or simulated with the same guess
+    Stored,
+
+    // Confirmed for a frame already simulated with a different guess, so it needs rolling back to
+    Mispredicted,
+
+    AlreadyConfirmed,
+
+    // Older than the rollback window and never confirmed
+    TooLate,
+
+    // Far enough ahead that its ring slot still holds a frame inside the rollback window
+    TooEarly
+};
+
+/**
+ * Per-frame history for one rollback participant, stored in fixed rings indexed by frame number
+ */
+struct RMC_API FRMCRollbackHistory
+{
+    static constexpr int32 Capacity = 64;
+
+    FRMCMovementSnapshot Snapshots[Capacity];
+    FRMCRollbackInput Inputs[Capacity];
+    int32 InputFrames[Capacity];
+    bool bInputConfirmed[Capacity];
+
+    // Most recent frame with a confirmed input, and that input for predicting from
+    int32 LastConfirmedFrame = INDEX_NONE;
+    FRMCRollbackInput LastConfirmedInput;
+
+    FRMCRollbackHistory();
+
+    static int32 ToIndex(int32 Frame) { return Frame & (Capacity - 1); }
+
+    /** Input recorded for Frame, or nullptr if the ring slot holds a different frame */
+    const FRMCRollbackInput* FindInput(int32 Frame) const;
+
+    bool IsConfirmed(int32 Frame) const { return InputFrames[ToIndex(Frame)] == Frame && bInputConfirmed[ToIndex(Frame)]; }
+
+    void SetInput(int32 Frame, const FRMCRollbackInput& Input, bool bConfirmed);
+
+    /**
+     * Records a remote peer's confirmed input for Frame. The ring holds frames OldestFrame through
+     * OldestFrame + Capacity - 1, so anything past that is refused rather than written over a frame a
+     * rollback may still need.
+     */
+    ERMCRemoteInputResult ReceiveRemoteInput(int32 Frame, const FRMCRollbackInput& Input, int32 OldestFrame, int32 CurrentFrame);
+};
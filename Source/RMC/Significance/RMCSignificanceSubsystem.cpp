@@ -0,0 +1,239 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCSignificanceSubsystem.h"
+#include "../RMCCharacter.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "SignificanceManager.h"
+
+static const FName RMCCharacterSignificanceTag(TEXT("RMCCharacter"));
+
+URMCSignificanceSubsystem::URMCSignificanceSubsystem()
+{
+    ReducedDistance = 2500.0f;
+    MinimalDistance = 6000.0f;
+    DormantDistance = 12000.0f;
+    OffscreenDistanceScale = 3.0f;
+    HysteresisFraction = 0.1f;
+    MaxFullCharacters = 24;
+    UpdateInterval = 0.1f;
+
+    bEnabled = true;
+    UpdateElapsed = 0.0f;
+}
+
+void URMCSignificanceSubsystem::Deinitialize()
+{
+    Characters.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId URMCSignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(URMCSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void URMCSignificanceSubsystem::RegisterCharacter(ARMCCharacter* Character)
+{
+    Characters.AddUnique(Character);
+
+    USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+    if (!SignificanceManager)
+    {
+        return;
+    }
+
+    // Distance to this viewer, negated so the nearest viewer gives the highest significance
+    SignificanceManager->RegisterObject(Character, RMCCharacterSignificanceTag,
+        [this](USignificanceManager::FManagedObjectInfo* Info, const FTransform& Viewpoint)
+        {
+            const AActor* Actor = CastChecked<AActor>(Info->GetObject());
+            const FVector ToActor = Actor->GetActorLocation() - Viewpoint.GetLocation();
+
+            float Distance = ToActor.Size();
+            if (FVector::DotProduct(ToActor, Viewpoint.GetRotation().GetForwardVector()) < 0.0f)
+            {
+                Distance *= OffscreenDistanceScale;
+            }
+
+            return -Distance;
+        });
+}
+
+void URMCSignificanceSubsystem::UnregisterCharacter(ARMCCharacter* Character)
+{
+    Characters.RemoveSwap(Character);
+
+    if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+    {
+        SignificanceManager->UnregisterObject(Character);
+    }
+}
+
+void URMCSignificanceSubsystem::SetEnabled(bool bInEnabled)
+{
+    bEnabled = bInEnabled;
+    UpdateElapsed = UpdateInterval;
+
+    if (!bEnabled)
+    {
+        for (ARMCCharacter* Character : Characters)
+        {
+            if (IsValid(Character))
+            {
+                Character->SetMovementLOD(ERMCMovementLOD::Full);
+            }
+        }
+    }
+}
+
+void URMCSignificanceSubsystem::Tick(float DeltaTime)
+{
+    UpdateElapsed += DeltaTime;
+    if (!bEnabled || UpdateElapsed < UpdateInterval || Characters.Num() == 0)
+    {
+        return;
+    }
+    UpdateElapsed = 0.0f;
+
+    UWorld* World = GetWorld();
+    USignificanceManager* SignificanceManager = USignificanceManager::Get(World);
+    if (!SignificanceManager)
+    {
+        return;
+    }
+
+    // Every player's view. A server knows where remote players are looking too.
+    TArray<FTransform, TInlineAllocator<16>> Viewpoints;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        if (!PlayerController)
+        {
+            continue;
+        }
+
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        Viewpoints.Add(FTransform(ViewRotation, ViewLocation));
+    }
+
+    // Nobody to look at them, e.g. a server running only bots; leave the tiers as they are
+    if (Viewpoints.Num() == 0)
+    {
+        return;
+    }
+
+    SignificanceManager->Update(Viewpoints);
+
+    struct FCandidate
+    {
+        ARMCCharacter* Character;
+        float Distance;
+        ERMCMovementLOD Tier;
+    };
+
+    TArray<FCandidate, TInlineAllocator<256>> Candidates;
+    int32 NumFull = 0;
+    for (ARMCCharacter* Character : Characters)
+    {
+        const URMCMovementComponent* MovementComponent = IsValid(Character) ? Character->GetRMCMovementComponent() : nullptr;
+        if (!MovementComponent)
+        {
+            continue;
+        }
+
+        if (RequiresFullLOD(Character))
+        {
+            Character->SetMovementLOD(ERMCMovementLOD::Full);
+            ++NumFull;
+            continue;
+        }
+
+        const float Distance = -SignificanceManager->GetSignificance(Character);
+        Candidates.Add({ Character, Distance, PickTier(Distance, MovementComponent->GetMovementLOD()) });
+    }
+
+    // The closest keep Full up to the budget
+    Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.Distance < B.Distance; });
+    for (FCandidate& Candidate : Candidates)
+    {
+        if (Candidate.Tier == ERMCMovementLOD::Full && ++NumFull > MaxFullCharacters)
+        {
+            Candidate.Tier = ERMCMovementLOD::Reduced;
+        }
+
+        Candidate.Character->SetMovementLOD(Candidate.Tier);
+    }
+}
+
+ERMCMovementLOD URMCSignificanceSubsystem::PickTier(float Distance, ERMCMovementLOD CurrentTier) const
+{
+    const float Boundaries[] = { ReducedDistance, MinimalDistance, DormantDistance };
+
+    int32 Tier = 0;
+    for (int32 Index = 0; Index < UE_ARRAY_COUNT(Boundaries); ++Index)
+    {
+        // A boundary the character is already past has to be recrossed by the hysteresis margin
+        const bool bPastBoundary = static_cast<int32>(CurrentTier) > Index;
+        const float Boundary = bPastBoundary ? Boundaries[Index] * (1.0f - HysteresisFraction) : Boundaries[Index];
+        if (Distance > Boundary)
+        {
+            Tier = Index + 1;
+        }
+    }
+
+    return static_cast<ERMCMovementLOD>(Tier);
+}
+
+bool URMCSignificanceSubsystem::RequiresFullLOD(const ARMCCharacter* Character)
+{
+    return Character->IsPlayerControlled() || Character->IsRollbackControlled() || Character->bDebugModeEnabled;
+}
+
+void URMCSignificanceSubsystem::LogTierCounts() const
+{
+    int32 Counts[4] = {};
+    for (const ARMCCharacter* Character : Characters)
+    {
+        if (const URMCMovementComponent* MovementComponent = IsValid(Character) ? Character->GetRMCMovementComponent() : nullptr)
+        {
+            ++Counts[static_cast<int32>(MovementComponent->GetMovementLOD())];
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("RMC movement LOD%s: %d full, %d reduced, %d minimal, %d dormant"), bEnabled ? TEXT("") : TEXT(" (disabled)"),
+        Counts[0], Counts[1], Counts[2], Counts[3]);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Console commands
+
+namespace RMCSignificanceCommands
+{
+    static FAutoConsoleCommandWithWorldAndArgs EnableCommand(
+        TEXT("rmc.LOD.Enable"),
+        TEXT("Turns RMC movement LOD on or off. Off returns every character to full fidelity. Usage: rmc.LOD.Enable [0|1]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            if (URMCSignificanceSubsystem* Subsystem = World ? World->GetSubsystem<URMCSignificanceSubsystem>() : nullptr)
+            {
+                Subsystem->SetEnabled(Args.Num() > 0 ? FCString::ToBool(*Args[0]) : !Subsystem->IsEnabled());
+                Subsystem->LogTierCounts();
+            }
+        }));
+
+    static FAutoConsoleCommandWithWorldAndArgs StatsCommand(
+        TEXT("rmc.LOD.Stats"),
+        TEXT("Logs how many RMC characters are in each movement LOD tier"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            if (const URMCSignificanceSubsystem* Subsystem = World ? World->GetSubsystem<URMCSignificanceSubsystem>() : nullptr)
+            {
+                Subsystem->LogTierCounts();
+            }
+        }));
+}
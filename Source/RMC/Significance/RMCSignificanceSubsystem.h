@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "../Components/Movement/RMCMovementComponent.h"
+#include "RMCSignificanceSubsystem.generated.h"
+
+class ARMCCharacter;
+
+/**
+ * Movement LOD for RMC characters. Feeds every player's view to the engine's significance manager, which
+ * scores each character by its distance to the nearest viewer (further when behind them), then moves
+ * characters between ERMCMovementLOD tiers. A tier boundary is crossed outward at its distance and inward
+ * only HysteresisFraction closer, so characters near a boundary don't thrash between tiers.
+ *
+ * Characters a player controls, and rollback characters, always stay at Full.
+ */
+UCLASS()
+class RMC_API URMCSignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    URMCSignificanceSubsystem();
+
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterCharacter(ARMCCharacter* Character);
+
+    void UnregisterCharacter(ARMCCharacter* Character);
+
+    /** Turns LOD on or off. Off returns every character to Full. */
+    void SetEnabled(bool bInEnabled);
+
+    bool IsEnabled() const { return bEnabled; }
+
+    /** Logs how many characters are in each tier */
+    void LogTierCounts() const;
+
+    // Distance to the nearest viewer beyond which a character drops to Reduced, Minimal and Dormant
+    float ReducedDistance;
+    float MinimalDistance;
+    float DormantDistance;
+
+    /** Behind every viewer, a character counts as this much further away */
+    float OffscreenDistanceScale;
+
+    /** Fraction of a boundary's distance a character must come back inside before it moves up a tier */
+    float HysteresisFraction;
+
+    /** Most characters kept at Full; the least significant beyond this drop to Reduced */
+    int32 MaxFullCharacters;
+
+    /** Seconds between tier updates */
+    float UpdateInterval;
+
+private:
+    /** Tier for a distance, given the tier the character is in now */
+    ERMCMovementLOD PickTier(float Distance, ERMCMovementLOD CurrentTier) const;
+
+    /** Whether a character has to stay at Full whatever its distance */
+    static bool RequiresFullLOD(const ARMCCharacter* Character);
+
+    UPROPERTY()
+    TArray<TObjectPtr<ARMCCharacter>> Characters;
+
+    bool bEnabled;
+    float UpdateElapsed;
+};
@@ -0,0 +1,535 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RMCSoakSubsystem.h"
+#include "../RMCCharacter.h"
+#include "../Components/Movement/RMCMovementComponent.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+URMCSoakSubsystem::URMCSoakSubsystem()
+{
+    StageIndex = 0;
+    StageSeconds = 0.0f;
+    StageElapsed = 0.0f;
+    bUseBotProcesses = false;
+    bSoaking = false;
+    bBotClient = false;
+    bExitWhenDone = false;
+
+    SampleElapsed = 0.0f;
+    SampleFrames = 0;
+    SampleFrameSeconds = 0.0;
+    SampleMaxFrameSeconds = 0.0;
+    SampleMovementSeconds = 0.0;
+    SoakElapsed = 0.0;
+}
+
+void URMCSoakSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (InWorld.GetNetMode() == NM_Client)
+    {
+        // A bot process drives its own character once the server gives it one
+        bBotClient = FParse::Param(FCommandLine::Get(), TEXT("rmcsoakbot"));
+        return;
+    }
+
+    FString StageList;
+    if (!FParse::Value(FCommandLine::Get(), TEXT("rmcsoak="), StageList))
+    {
+        return;
+    }
+
+    TArray<FString> StageStrings;
+    StageList.ParseIntoArray(StageStrings, TEXT(","));
+
+    TArray<int32> PlayerCounts;
+    for (const FString& StageString : StageStrings)
+    {
+        PlayerCounts.Add(FCString::Atoi(*StageString));
+    }
+
+    float Minutes = 30.0f;
+    FParse::Value(FCommandLine::Get(), TEXT("rmcsoakminutes="), Minutes);
+
+    StartSoak(PlayerCounts, Minutes, FParse::Param(FCommandLine::Get(), TEXT("rmcsoakprocs")));
+    bExitWhenDone = bSoaking;
+
+    // Nobody is watching an unattended run, so a soak that can't start shouldn't leave the server idling
+    if (!bSoaking)
+    {
+        UE_LOG(LogTemp, Error, TEXT("RMC soak: could not start the soak given on the command line"));
+        FPlatformMisc::RequestExitWithStatus(false, 1);
+    }
+}
+
+void URMCSoakSubsystem::Deinitialize()
+{
+    StopSoak();
+
+    Super::Deinitialize();
+}
+
+TStatId URMCSoakSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(URMCSoakSubsystem, STATGROUP_Tickables);
+}
+
+void URMCSoakSubsystem::StartSoak(const TArray<int32>& PlayerCounts, float StageMinutes, bool bSeparateProcesses)
+{
+    UWorld* World = GetWorld();
+    if (!World || World->GetNetMode() == NM_Client)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RMC soak: run on a server"));
+        return;
+    }
+
+    StopSoak();
+
+    Stages.Reset();
+    for (const int32 PlayerCount : PlayerCounts)
+    {
+        if (PlayerCount > 0)
+        {
+            Stages.Add(PlayerCount);
+        }
+    }
+
+    if (Stages.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RMC soak: no player counts given"));
+        return;
+    }
+
+    BotExecutable.Reset();
+    if (bSeparateProcesses && !FindBotExecutable(BotExecutable))
+    {
+        UE_LOG(LogTemp, Error, TEXT("RMC soak: no game binary for bot processes. Pass its path with -rmcsoakclientexe="));
+        return;
+    }
+
+    StageIndex = 0;
+    StageSeconds = FMath::Max(StageMinutes, 0.1f) * 60.0f;
+    bUseBotProcesses = bSeparateProcesses;
+    bSoaking = true;
+    SoakElapsed = 0.0;
+
+    // Bandwidth per connection is only meaningful with bots on the other end of one
+    if (!bUseBotProcesses && World->GetNetMode() == NM_DedicatedServer)
+    {
+        UE_LOG(LogTemp, Display, TEXT("RMC soak: in-process bots have no connection, so bandwidth will read zero"));
+    }
+
+    CsvPath = FPaths::ProfilingDir() / TEXT("RMCSoak") / FString::Printf(TEXT("Soak-%s.csv"), *FDateTime::Now().ToString());
+    FFileHelper::SaveStringToFile(
+        TEXT("Seconds,Players,FrameMs,MaxFrameMs,MovementMs,Connections,OutBytesPerConnection,InBytesPerConnection,UsedPhysicalMB\n"), *CsvPath);
+
+    UE_LOG(LogTemp, Display, TEXT("RMC soak: %d stages of %.1f minutes with %s bots, writing %s"),
+        Stages.Num(), StageSeconds / 60.0f, bUseBotProcesses ? TEXT("process") : TEXT("in-process"), *CsvPath);
+
+    BeginStage();
+}
+
+void URMCSoakSubsystem::StopSoak()
+{
+    for (FProcHandle& Process : BotProcesses)
+    {
+        if (Process.IsValid())
+        {
+            FPlatformProcess::TerminateProc(Process, true);
+            FPlatformProcess::CloseProc(Process);
+        }
+    }
+    BotProcesses.Reset();
+
+    // Spawned bots go; a bot client keeps driving its own character
+    if (!bBotClient)
+    {
+        for (FBot& Bot : Bots)
+        {
+            if (ARMCCharacter* Character = Bot.Character.Get())
+            {
+                Character->Destroy();
+            }
+        }
+        Bots.Reset();
+    }
+
+    bSoaking = false;
+}
+
+void URMCSoakSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (bBotClient && Bots.Num() == 0)
+    {
+        const APlayerController* Controller = GetWorld()->GetFirstPlayerController();
+        if (ARMCCharacter* Character = Controller ? Cast<ARMCCharacter>(Controller->GetPawn()) : nullptr)
+        {
+            AddBot(Character);
+        }
+    }
+
+    for (FBot& Bot : Bots)
+    {
+        DriveBot(Bot, DeltaTime);
+    }
+
+    if (!bSoaking)
+    {
+        return;
+    }
+
+    // Time the server spent working this frame, not waiting for the tick rate
+    const double FrameSeconds = FMath::Max(FApp::GetDeltaTime() - FApp::GetIdleTime(), 0.0);
+    ++SampleFrames;
+    SampleFrameSeconds += FrameSeconds;
+    SampleMaxFrameSeconds = FMath::Max(SampleMaxFrameSeconds, FrameSeconds);
+    SampleMovementSeconds += URMCMovementComponent::ConsumeMovementSeconds();
+
+    SampleElapsed += DeltaTime;
+    if (SampleElapsed >= 1.0f)
+    {
+        WriteSample();
+    }
+
+    StageElapsed += DeltaTime;
+    if (StageElapsed >= StageSeconds)
+    {
+        EndStage();
+    }
+}
+
+void URMCSoakSubsystem::DriveBot(FBot& Bot, float DeltaTime)
+{
+    ARMCCharacter* Character = Bot.Character.Get();
+    if (!Character)
+    {
+        return;
+    }
+
+    // Jumps are held for one frame
+    if (Bot.bReleaseJump)
+    {
+        Character->OnJumpActionReleased();
+        Bot.bReleaseJump = false;
+    }
+
+    Bot.TurnTimer -= DeltaTime;
+    if (Bot.TurnTimer <= 0.0f)
+    {
+        Bot.Heading = Bot.Random.FRandRange(0.0f, 360.0f);
+        Bot.TurnTimer = Bot.Random.FRandRange(1.0f, 4.0f);
+    }
+
+    Bot.ActionTimer -= DeltaTime;
+    if (Bot.ActionTimer <= 0.0f)
+    {
+        Bot.ActionTimer = Bot.Random.FRandRange(0.5f, 2.0f);
+
+        if (Bot.bSliding)
+        {
+            Character->OnSlideActionReleased();
+            Bot.bSliding = false;
+        }
+
+        // Jumping is twice as likely so airborne bots get double jumps and wall runs
+        switch (Bot.Random.RandHelper(4))
+        {
+        case 0:
+        case 1:
+            Character->OnJumpActionPressed();
+            Bot.bReleaseJump = true;
+            break;
+        case 2:
+            Character->OnDashActionPressed();
+            break;
+        default:
+            Character->OnSlideActionPressed();
+            Bot.bSliding = true;
+            break;
+        }
+    }
+
+    Character->AddMovementInput(FRotator(0.0f, Bot.Heading, 0.0f).Vector(), 1.0f);
+}
+
+void URMCSoakSubsystem::AddBot(ARMCCharacter* Character)
+{
+    FBot& Bot = Bots.AddDefaulted_GetRef();
+    Bot.Character = Character;
+    Bot.Random.Initialize(GetTypeHash(Character->GetFName()) ^ Bots.Num());
+    Bot.Heading = Bot.Random.FRandRange(0.0f, 360.0f);
+}
+
+void URMCSoakSubsystem::SpawnLocalBot()
+{
+    UWorld* World = GetWorld();
+
+    TSubclassOf<ARMCCharacter> CharacterClass = ARMCCharacter::StaticClass();
+    if (const AGameModeBase* GameMode = World->GetAuthGameMode())
+    {
+        if (GameMode->DefaultPawnClass && GameMode->DefaultPawnClass->IsChildOf<ARMCCharacter>())
+        {
+            CharacterClass = GameMode->DefaultPawnClass.Get();
+        }
+    }
+
+    // Scatter around the first player start so the bots don't spawn inside each other
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    for (TActorIterator<APlayerStart> It(World); It; ++It)
+    {
+        Location = It->GetActorLocation();
+        Rotation = It->GetActorRotation();
+        break;
+    }
+    Location += FVector(FMath::FRandRange(-2000.0f, 2000.0f), FMath::FRandRange(-2000.0f, 2000.0f), 0.0f);
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    ARMCCharacter* Character = World->SpawnActor<ARMCCharacter>(CharacterClass, Location, Rotation, SpawnParams);
+    if (!Character)
+    {
+        return;
+    }
+
+    // Movement only runs for a controlled character
+    Character->SpawnDefaultController();
+    AddBot(Character);
+}
+
+bool URMCSoakSubsystem::FindBotExecutable(FString& OutPath) const
+{
+    if (FParse::Value(FCommandLine::Get(), TEXT("rmcsoakclientexe="), OutPath))
+    {
+        if (FPaths::FileExists(OutPath))
+        {
+            return true;
+        }
+
+        UE_LOG(LogTemp, Error, TEXT("RMC soak: -rmcsoakclientexe=%s does not exist"), *OutPath);
+        return false;
+    }
+
+#if WITH_EDITOR
+    // The editor runs as a game with -game
+    OutPath = FPlatformProcess::ExecutablePath();
+    return true;
+#else
+    if (!IsRunningDedicatedServer())
+    {
+        OutPath = FPlatformProcess::ExecutablePath();
+        return true;
+    }
+
+    // A server build can't connect to anything, so look for the client or game build of the same configuration
+    const FString ServerPath = FPlatformProcess::ExecutablePath();
+    const FString ServerName = FPaths::GetCleanFilename(ServerPath);
+    for (const TCHAR* Replacement : { TEXT("Client"), TEXT("") })
+    {
+        const FString Candidate = FPaths::GetPath(ServerPath) / ServerName.Replace(TEXT("Server"), Replacement, ESearchCase::CaseSensitive);
+        if (Candidate != ServerPath && FPaths::FileExists(Candidate))
+        {
+            OutPath = Candidate;
+            return true;
+        }
+    }
+
+    return false;
+#endif
+}
+
+void URMCSoakSubsystem::LaunchBotProcess()
+{
+    const UWorld* World = GetWorld();
+
+    FString Params = FString::Printf(TEXT("127.0.0.1:%d -nullrhi -nosound -unattended -rmcsoakbot -log=RMCSoakBot%d.log"),
+        World->URL.Port, BotProcesses.Num());
+#if WITH_EDITOR
+    // The editor binary needs the project and -game to run as a client
+    if (BotExecutable == FPlatformProcess::ExecutablePath())
+    {
+        Params = FString::Printf(TEXT("\"%s\" %s -game"), *FPaths::GetProjectFilePath(), *Params);
+    }
+#endif
+
+    FProcHandle Process = FPlatformProcess::CreateProc(*BotExecutable, *Params, true, true, true, nullptr, 0, nullptr, nullptr);
+    if (!Process.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("RMC soak: could not start a bot process from %s"), *BotExecutable);
+        return;
+    }
+
+    BotProcesses.Add(Process);
+}
+
+void URMCSoakSubsystem::BeginStage()
+{
+    const int32 PlayerCount = Stages[StageIndex];
+    if (bUseBotProcesses)
+    {
+        while (BotProcesses.Num() < PlayerCount)
+        {
+            const int32 NumBefore = BotProcesses.Num();
+            LaunchBotProcess();
+            if (BotProcesses.Num() == NumBefore)
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        while (Bots.Num() < PlayerCount)
+        {
+            const int32 NumBefore = Bots.Num();
+            SpawnLocalBot();
+            if (Bots.Num() == NumBefore)
+            {
+                break;
+            }
+        }
+    }
+
+    StageElapsed = 0.0f;
+    StageTotals = FStageTotals();
+    SampleElapsed = 0.0f;
+    SampleFrames = 0;
+    SampleFrameSeconds = 0.0;
+    SampleMaxFrameSeconds = 0.0;
+    SampleMovementSeconds = 0.0;
+    URMCMovementComponent::ConsumeMovementSeconds();
+
+    UE_LOG(LogTemp, Display, TEXT("RMC soak: stage %d of %d, %d players"), StageIndex + 1, Stages.Num(), PlayerCount);
+}
+
+void URMCSoakSubsystem::EndStage()
+{
+    const int32 Samples = FMath::Max(StageTotals.Samples, 1);
+    UE_LOG(LogTemp, Display, TEXT("RMC soak: %d players, frame %.2f ms average %.2f ms worst, movement %.2f ms per frame, out %.0f B/s per connection"),
+        Stages[StageIndex], StageTotals.FrameMilliseconds / Samples, StageTotals.MaxFrameMilliseconds,
+        StageTotals.MovementMilliseconds / Samples, StageTotals.OutBytesPerConnection / Samples);
+
+    if (++StageIndex < Stages.Num())
+    {
+        BeginStage();
+        return;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("RMC soak finished: %s"), *CsvPath);
+    StopSoak();
+
+    if (bExitWhenDone)
+    {
+        FPlatformMisc::RequestExit(false);
+    }
+}
+
+void URMCSoakSubsystem::WriteSample()
+{
+    const UWorld* World = GetWorld();
+
+    int32 NumCharacters = 0;
+    for (TActorIterator<ARMCCharacter> It(World); It; ++It)
+    {
+        ++NumCharacters;
+    }
+
+    int64 OutBytes = 0;
+    int64 InBytes = 0;
+    int32 NumConnections = 0;
+    if (const UNetDriver* NetDriver = World->GetNetDriver())
+    {
+        for (const UNetConnection* Connection : NetDriver->ClientConnections)
+        {
+            OutBytes += Connection->OutBytesPerSecond;
+            InBytes += Connection->InBytesPerSecond;
+            ++NumConnections;
+        }
+    }
+
+    const int32 Frames = FMath::Max(SampleFrames, 1);
+    const double FrameMilliseconds = SampleFrameSeconds * 1000.0 / Frames;
+    const double MaxFrameMilliseconds = SampleMaxFrameSeconds * 1000.0;
+    const double MovementMilliseconds = SampleMovementSeconds * 1000.0 / Frames;
+    const double OutPerConnection = NumConnections > 0 ? static_cast<double>(OutBytes) / NumConnections : 0.0;
+    const double InPerConnection = NumConnections > 0 ? static_cast<double>(InBytes) / NumConnections : 0.0;
+    const double UsedPhysicalMB = FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+
+    SoakElapsed += SampleElapsed;
+    const FString Row = FString::Printf(TEXT("%.0f,%d,%.3f,%.3f,%.3f,%d,%.0f,%.0f,%.1f\n"), SoakElapsed, NumCharacters,
+        FrameMilliseconds, MaxFrameMilliseconds, MovementMilliseconds, NumConnections, OutPerConnection, InPerConnection, UsedPhysicalMB);
+    FFileHelper::SaveStringToFile(Row, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+
+    ++StageTotals.Samples;
+    StageTotals.FrameMilliseconds += FrameMilliseconds;
+    StageTotals.MaxFrameMilliseconds = FMath::Max(StageTotals.MaxFrameMilliseconds, MaxFrameMilliseconds);
+    StageTotals.MovementMilliseconds += MovementMilliseconds;
+    StageTotals.OutBytesPerConnection += OutPerConnection;
+
+    SampleElapsed = 0.0f;
+    SampleFrames = 0;
+    SampleFrameSeconds = 0.0;
+    SampleMaxFrameSeconds = 0.0;
+    SampleMovementSeconds = 0.0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Console commands
+
+namespace RMCSoakCommands
+{
+    static FAutoConsoleCommandWithWorldAndArgs StartCommand(
+        TEXT("rmc.Soak.Start"),
+        TEXT("Runs a movement soak on the server, one stage per player count, logging to Saved/Profiling/RMCSoak. ")
+        TEXT("Usage: rmc.Soak.Start [PlayerCounts=8,32,64,128] [StageMinutes=30] [procs] where procs starts bot client processes instead of in-process bots."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            URMCSoakSubsystem* Subsystem = World ? World->GetSubsystem<URMCSoakSubsystem>() : nullptr;
+            if (!Subsystem)
+            {
+                return;
+            }
+
+            TArray<FString> StageStrings;
+            (Args.Num() > 0 ? Args[0] : FString(TEXT("8,32,64,128"))).ParseIntoArray(StageStrings, TEXT(","));
+
+            TArray<int32> PlayerCounts;
+            for (const FString& StageString : StageStrings)
+            {
+                PlayerCounts.Add(FCString::Atoi(*StageString));
+            }
+
+            const float Minutes = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 30.0f;
+            const bool bProcesses = Args.Num() > 2 && Args[2].Equals(TEXT("procs"), ESearchCase::IgnoreCase);
+            Subsystem->StartSoak(PlayerCounts, Minutes, bProcesses);
+        }));
+
+    static FAutoConsoleCommandWithWorldAndArgs StopCommand(
+        TEXT("rmc.Soak.Stop"),
+        TEXT("Ends the soak and its bot processes"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+        {
+            if (URMCSoakSubsystem* Subsystem = World ? World->GetSubsystem<URMCSoakSubsystem>() : nullptr)
+            {
+                Subsystem->StopSoak();
+            }
+        }));
+}
@@ -0,0 +1,122 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HAL/PlatformProcess.h"
+#include "Math/RandomStream.h"
+#include "RMCSoakSubsystem.generated.h"
+
+class ARMCCharacter;
+
+/**
+ * Long-running load test for the movement system. On a server it brings bots up to each player count in
+ * turn and writes one CSV row per second of server frame time, movement CPU, bandwidth per connection and
+ * memory to Saved/Profiling/RMCSoak. Bots are either characters the server spawns and drives itself, or
+ * headless client processes started with -rmcsoakbot that drive their own character over the network.
+ *
+ * Start it with rmc.Soak.Start, or from the command line with -rmcsoak=8,32,64,128 -rmcsoakminutes=30
+ * [-rmcsoakprocs], in which case the server exits when the last stage ends. Run the server with -nullrhi.
+ * Bot processes run the game binary named by -rmcsoakclientexe=, or by default the one built beside this
+ * server; the soak won't start without one.
+ */
+UCLASS()
+class RMC_API URMCSoakSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    URMCSoakSubsystem();
+
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * On a server, runs one stage per entry in PlayerCounts, each StageMinutes long. With bSeparateProcesses
+     * the bots are local client processes, otherwise characters spawned in this world.
+     */
+    void StartSoak(const TArray<int32>& PlayerCounts, float StageMinutes, bool bSeparateProcesses);
+
+    /** Ends the soak and stops every bot process it started */
+    void StopSoak();
+
+    bool IsSoaking() const { return bSoaking; }
+
+private:
+    /** Randomized traversal state for one bot character */
+    struct FBot
+    {
+        TWeakObjectPtr<ARMCCharacter> Character;
+        FRandomStream Random;
+        float Heading = 0.0f;
+        float TurnTimer = 0.0f;
+        float ActionTimer = 0.0f;
+        bool bReleaseJump = false;
+        bool bSliding = false;
+    };
+
+    /** Per-stage totals for the summary logged when a stage ends */
+    struct FStageTotals
+    {
+        int32 Samples = 0;
+        double FrameMilliseconds = 0.0;
+        double MaxFrameMilliseconds = 0.0;
+        double MovementMilliseconds = 0.0;
+        double OutBytesPerConnection = 0.0;
+    };
+
+    /** Steers and presses buttons for one bot */
+    void DriveBot(FBot& Bot, float DeltaTime);
+
+    void AddBot(ARMCCharacter* Character);
+
+    void SpawnLocalBot();
+
+    /**
+     * Finds the binary bot processes run: -rmcsoakclientexe=, the editor itself, or the client or game build
+     * beside a server build. Returns false if there is none.
+     */
+    bool FindBotExecutable(FString& OutPath) const;
+
+    void LaunchBotProcess();
+
+    /** Brings the bots up to the current stage's player count */
+    void BeginStage();
+
+    /** Logs the stage summary and starts the next stage, or ends the soak after the last */
+    void EndStage();
+
+    /** Appends one CSV row covering the frames since the last sample */
+    void WriteSample();
+
+    TArray<FBot> Bots;
+    TArray<FProcHandle> BotProcesses;
+    FString BotExecutable;
+
+    TArray<int32> Stages;
+    int32 StageIndex;
+    float StageSeconds;
+    float StageElapsed;
+    bool bUseBotProcesses;
+    bool bSoaking;
+
+    // Whether this is a -rmcsoakbot client waiting for its character
+    bool bBotClient;
+
+    // Set when the command line started the soak, so the server exits after the last stage
+    bool bExitWhenDone;
+
+    // Frames since the last CSV row
+    float SampleElapsed;
+    int32 SampleFrames;
+    double SampleFrameSeconds;
+    double SampleMaxFrameSeconds;
+    double SampleMovementSeconds;
+
+    FStageTotals StageTotals;
+    double SoakElapsed;
+    FString CsvPath;
+};